@@ -0,0 +1,97 @@
+#version 460
+
+// Blur and sharpen pre-pass, run by FilterPrepass once per source per
+// frame so the block shaders read the result with a single fetch.
+//
+// Both filters are separable 9 tap Gaussians reaching blurRadius /
+// sharpenRadius texels either side. Taps are radius/4 apart and read from
+// the mip level of that spacing, so the cost does not grow with the radius
+// and wide radii average rather than alias.
+//
+// pass 0, horizontal: rgb is the blurred colour, a the mean brightness
+// around each texel for the sharpen.
+// pass 1, vertical: finishes both and combines them with the source.
+
+uniform sampler2D tex0;         // source in pass 0, the horizontal pass in pass 1
+uniform sampler2D source;       // pass 1 only
+
+uniform int pass;
+uniform vec2 texelSize;
+uniform float blurAmount;
+uniform float blurRadius;
+uniform float sharpenAmount;
+uniform float sharpenRadius;
+uniform float sharpenBoost;
+
+in vec2 texCoordVarying;
+
+out vec4 outputColor;
+
+const float WEIGHTS[5]=float[](1.0, 0.8825, 0.6065, 0.3247, 0.1353);
+const float WEIGHT_SUM=4.8980;
+
+vec3 rgb2hsb(vec3 c)
+{
+    vec4 K = vec4(0.0, -1.0 / 3.0, 2.0 / 3.0, -1.0);
+    vec4 p = mix(vec4(c.bg, K.wz), vec4(c.gb, K.xy), step(c.b, c.g));
+    vec4 q = mix(vec4(p.xyw, c.r), vec4(c.r, p.yzx), step(p.x, c.r));
+
+    float d = q.x - min(q.w, q.y);
+    float e = 1.0e-10;
+    return vec3(abs(q.z + (q.w - q.y) / (6.0 * d + e)), d / (q.x + e), q.x);
+}
+
+vec3 hsb2rgb(vec3 c)
+{
+    vec4 K = vec4(1.0, 2.0 / 3.0, 1.0 / 3.0, 3.0);
+    vec3 p = abs(fract(c.xxx + K.xyz) * 6.0 - K.www);
+    return c.z * mix(K.xxx, clamp(p - K.xxx, 0.0, 1.0), c.y);
+}
+
+float brightness(vec3 c)
+{
+	return max(c.r, max(c.g, c.b));
+}
+
+void main()
+{
+	vec2 direction=pass==0 ? vec2(texelSize.x, 0.0) : vec2(0.0, texelSize.y);
+	float blurStep=blurRadius*0.25;
+	float sharpenStep=sharpenRadius*0.25;
+
+	if(pass==0){
+		// Negative radii mirror the taps; the spacing, and so the level, is the same
+		float blurLod=log2(max(abs(blurStep), 1.0));
+		float sharpenLod=log2(max(abs(sharpenStep), 1.0));
+		vec3 blur=vec3(0.0);
+		float bright=0.0;
+		for(int i=-4; i<=4; i++){
+			float w=WEIGHTS[abs(i)];
+			blur+=w*textureLod(tex0, texCoordVarying+direction*(blurStep*float(i)), blurLod).rgb;
+			bright+=w*brightness(textureLod(tex0, texCoordVarying+direction*(sharpenStep*float(i)), sharpenLod).rgb);
+		}
+		outputColor=vec4(blur, bright)/WEIGHT_SUM;
+		return;
+	}
+
+	vec3 blur=vec3(0.0);
+	float bright=0.0;
+	for(int i=-4; i<=4; i++){
+		float w=WEIGHTS[abs(i)];
+		blur+=w*textureLod(tex0, texCoordVarying+direction*(blurStep*float(i)), 0.0).rgb;
+		bright+=w*textureLod(tex0, texCoordVarying+direction*(sharpenStep*float(i)), 0.0).a;
+	}
+	blur/=WEIGHT_SUM;
+	bright/=WEIGHT_SUM;
+
+	vec4 originalColor=textureLod(source, texCoordVarying, 0.0);
+	vec3 colorBlur=mix(originalColor.rgb, blur, blurAmount);
+
+	vec3 colorBlurHsb=rgb2hsb(colorBlur);
+	colorBlurHsb.z-=sharpenAmount*bright;
+	if(sharpenAmount>0){
+		colorBlurHsb.z*=(1.0+sharpenAmount+sharpenBoost);
+	}
+
+	outputColor=vec4(hsb2rgb(colorBlurHsb), 1.0);
+}
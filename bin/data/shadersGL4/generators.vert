@@ -0,0 +1,17 @@
+#version 460
+
+// Line and ellipse generators. GeneratorBatch has already moved every
+// vertex into eye space, so only the projection is left.
+
+uniform mat4 projectionMatrix;
+
+in vec4 position;
+in vec4 color;
+
+out vec4 colorVarying;
+
+void main()
+{
+	colorVarying=color;
+	gl_Position=projectionMatrix*position;
+}
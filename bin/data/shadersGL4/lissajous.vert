@@ -0,0 +1,98 @@
+#version 460
+
+// Lissajous curve generator. There is no vertex data: the curve is drawn
+// as GL_LINES, segment s being vertices 2s and 2s + 1, and every point is
+// evaluated here from gl_VertexID and the parameter block below. Each
+// instance is a copy of the curve with its phase, hue and scale shifted.
+
+uniform mat4 modelViewProjectionMatrix;
+
+// Filled once per frame by ofApp::lissajousCurveRender
+layout(std140) uniform LissajousParams {
+	vec4 freq;          // x, y, z wave frequency
+	vec4 amp;           // x, y, z amplitude in pixels, size applied
+	vec4 phase;         // x, y, z phase
+	ivec4 shape;        // x, y, z wave shape, chop envelope shape
+	vec4 center;        // xy curve centre in pixels
+	vec4 hue;           // animation theta, color theta, hue, hue spread
+	vec4 chop;          // point count, chop count, visible ratio
+	vec4 instances;     // instance count, spread
+};
+
+out vec4 colorVarying;
+
+const float PI=3.1415926535;
+const float TWO_PI=6.2831855;
+
+float wave(float theta, int waveShape)
+{
+	if(waveShape==1) return (2.0/PI)*asin(sin(theta));              // triangle
+	if(waveShape==2) return (2.0/TWO_PI)*mod(theta+PI, TWO_PI)-1.0;  // ramp
+	if(waveShape==3) return 1.0-(2.0/TWO_PI)*mod(theta+PI, TWO_PI);  // saw
+	if(waveShape==4) return sin(theta)>=0.0 ? 1.0 : -1.0;            // square
+	return sin(theta);                                               // sine
+}
+
+float chopEnvelope(float pos, int envelopeShape)
+{
+	if(envelopeShape==0) return sin(pos*PI);
+	if(envelopeShape==1) return 1.0-2.0*abs(pos-0.5);
+	if(envelopeShape==2) return pos;
+	if(envelopeShape==3) return 1.0-pos;
+	return 1.0;
+}
+
+vec3 hsb2rgb(vec3 c)
+{
+    vec4 K = vec4(1.0, 2.0 / 3.0, 1.0 / 3.0, 3.0);
+    vec3 p = abs(fract(c.xxx + K.xyz) * 6.0 - K.www);
+    return c.z * mix(K.xxx, clamp(p - K.xxx, 0.0, 1.0), c.y);
+}
+
+// Chop segment of point i, -1 where the chop hides it
+int chopOf(int i, int chopCount, float visibleRatio)
+{
+	float pos=float(i)/chop.x;
+	if(chopCount==1) return 0;
+	if(fract(pos*float(chopCount))>=visibleRatio) return -1;
+	return min(int(pos*float(chopCount)), chopCount-1);
+}
+
+void main()
+{
+	int points=int(chop.x);
+	int chopCount=int(chop.y);
+	float visibleRatio=chop.z;
+
+	int segment=gl_VertexID/2;
+	int i=segment+(gl_VertexID&1);
+
+	// Both ends have to be shown and in the same chop for the segment to be drawn
+	int startChop=chopOf(segment, chopCount, visibleRatio);
+	if(i>=points || startChop<0 || chopOf(segment+1, chopCount, visibleRatio)!=startChop){
+		// Outside the clip volume, so the segment is dropped before rasterizing
+		gl_Position=vec4(2.0, 2.0, 2.0, 1.0);
+		colorVarying=vec4(0.0);
+		return;
+	}
+
+	float pos=float(i)/chop.x;
+	float visiblePos=chopCount==1 ? pos : fract(pos*float(chopCount))/visibleRatio;
+	float brightness=(220.0/255.0)*chopEnvelope(visiblePos, shape.w);
+
+	// 0 for the first instance, approaching spread for the last
+	float offset=instances.y*float(gl_InstanceID)/instances.x;
+	vec3 instancePhase=phase.xyz+offset*TWO_PI*vec3(1.0, 0.5, 0.25);
+	vec3 instanceAmp=amp.xyz*(1.0-0.75*offset);
+
+	float t=hue.x+pos*TWO_PI*4.0;
+	vec3 point=vec3(
+		instanceAmp.x*wave(freq.x*t+instancePhase.x, shape.x),
+		instanceAmp.y*wave(freq.y*t+instancePhase.y, shape.y),
+		instanceAmp.z*wave(freq.z*t+instancePhase.z, shape.z));
+
+	float pointHue=fract(hue.z+pos*hue.w+hue.y+offset);
+	colorVarying=vec4(hsb2rgb(vec3(pointHue, 200.0/255.0, brightness)), 1.0);
+
+	gl_Position=modelViewProjectionMatrix*vec4(point+vec3(center.xy, 0.0), 1.0);
+}
@@ -0,0 +1,10 @@
+#version 460
+
+in vec4 colorVarying;
+
+out vec4 outputColor;
+
+void main()
+{
+	outputColor=colorVarying;
+}
@@ -0,0 +1,40 @@
+#version 460
+
+// Particle generator. One point per instance, read straight from the
+// buffer particles.comp has just advanced; there is no vertex data.
+
+struct Particle {
+	vec4 state;         // xy position in texture space, zw velocity
+	vec4 life;          // x age, y lifetime in frames, z hue offset
+};
+
+layout(std430, binding=0) readonly buffer Particles {
+	Particle particles[];
+};
+
+uniform float pointSize;
+uniform float hue;
+
+out vec4 colorVarying;
+
+const float PI=3.1415926535;
+
+vec3 hsb2rgb(vec3 c)
+{
+    vec4 K = vec4(1.0, 2.0 / 3.0, 1.0 / 3.0, 3.0);
+    vec3 p = abs(fract(c.xxx + K.xyz) * 6.0 - K.www);
+    return c.z * mix(K.xxx, clamp(p - K.xxx, 0.0, 1.0), c.y);
+}
+
+void main()
+{
+	Particle p=particles[gl_InstanceID];
+
+	// Fades in after spawning and out before dying, faster particles shift hue
+	float brightness=sin(PI*clamp(p.life.x/max(p.life.y, 1.0), 0.0, 1.0));
+	float pointHue=fract(hue+0.2*p.life.z+50.0*length(p.state.zw));
+	colorVarying=vec4(hsb2rgb(vec3(pointHue, 200.0/255.0, brightness)), 1.0);
+
+	gl_PointSize=pointSize;
+	gl_Position=vec4(p.state.xy*2.0-1.0, 0.0, 1.0);
+}
@@ -10,6 +10,8 @@ uniform sampler2D ch1Tex;
 uniform sampler2D ch2Tex;
 uniform sampler2D tex0; //fb2 for now
 uniform sampler2D fb1TemporalFilter;
+uniform vec2 fb1Scale;
+uniform vec2 fb1TemporalFilterScale;
 
 uniform vec2 input1XYFix;
 
@@ -46,11 +48,6 @@ uniform float ch1PosterizeInvert;
 uniform int ch1PosterizeSwitch;
 uniform float ch1KaleidoscopeAmount;
 uniform float ch1KaleidoscopeSlice;
-uniform float ch1BlurAmount;
-uniform float ch1BlurRadius;
-uniform float ch1SharpenAmount;
-uniform float ch1SharpenRadius;
-uniform float ch1FiltersBoost;
 
 uniform int ch1HMirror;
 uniform int ch1VMirror;
@@ -85,11 +82,6 @@ uniform float ch2PosterizeInvert;
 uniform int ch2PosterizeSwitch;
 uniform float ch2KaleidoscopeAmount;
 uniform float ch2KaleidoscopeSlice;
-uniform float ch2BlurAmount;
-uniform float ch2BlurRadius;
-uniform float ch2SharpenAmount;
-uniform float ch2SharpenRadius;
-uniform float ch2FiltersBoost;
 
 uniform int ch2HMirror;
 uniform int ch2VMirror;
@@ -136,15 +128,10 @@ uniform int fb1SaturationInvert;
 uniform int fb1BrightInvert;
 
 //fb1 filters
-uniform	float fb1BlurAmount;
-uniform	float fb1BlurRadius;
-uniform	float fb1SharpenAmount;
-uniform	float fb1SharpenRadius;
 uniform	float fb1TemporalFilter1Amount;
 uniform	float fb1TemporalFilter1Resonance;
 uniform	float fb1TemporalFilter2Amount;
 uniform	float fb1TemporalFilter2Resonance;
-uniform float fb1FiltersBoost;
 
 uniform float ch1CribX;
 uniform float ch2CribX;
@@ -154,6 +141,14 @@ in vec2 texCoordVarying;
 
 out vec4 outputColor;
 
+//blocks 1 and 2 render into the lower left of their buffers when the
+//resolution governor steps down, scale is that area's share of the buffer;
+//clamped so filtering never reaches past it
+vec4 scaledTextureLod(sampler2D tex,vec2 coord,vec2 scale){
+	vec2 halfTexel=0.5/vec2(textureSize(tex,0));
+	return textureLod(tex,clamp(coord*scale,halfTexel,scale-halfTexel),0);
+}
+
 //color space conversions
 vec3 rgb2hsb(vec3 c)
 {
@@ -187,53 +182,6 @@ vec3 colorQuantize(vec3 inColor, float amount, float amountInvert){
 	return inColor;
 }
 
-vec4 blurAndSharpen(sampler2D blurAndSharpenTex, vec2 coord,
-		float sharpenAmount, float sharpenRadius, float sharpenBoost,
-		float blurRadius, float blurAmount) {
-	vec4 originalColor = textureLod(blurAndSharpenTex, coord, 0);
-	vec2 texSize = vec2(textureSize(blurAndSharpenTex, 0));
-
-	vec2 blurSize = vec2(blurRadius) / (texSize - vec2(1));
-	vec2 sharpenSize = vec2(sharpenRadius) / (texSize - vec2(1));
-
-	//blur
-	vec4 colorBlur = textureLod(blurAndSharpenTex, coord + blurSize*vec2( 1, 1), 0)
-                  + textureLod(blurAndSharpenTex, coord + blurSize*vec2( 0, 1), 0)
-                  + textureLod(blurAndSharpenTex, coord + blurSize*vec2(-1, 1), 0)
-                  + textureLod(blurAndSharpenTex, coord + blurSize*vec2(-1, 0), 0)
-                  + textureLod(blurAndSharpenTex, coord + blurSize*vec2(-1,-1), 0)
-                  + textureLod(blurAndSharpenTex, coord + blurSize*vec2( 0,-1), 0)
-                  + textureLod(blurAndSharpenTex, coord + blurSize*vec2( 1,-1), 0)
-                  + textureLod(blurAndSharpenTex, coord + blurSize*vec2( 1, 0), 0);
-
-	colorBlur*=.125;
-
-	colorBlur=mix(originalColor,colorBlur,blurAmount);
-
-	//sharpen
-	float color_sharpen_bright =
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2( 1, 0), 0).rgb).z+
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2(-1, 0), 0).rgb).z+
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2( 0, 1), 0).rgb).z+
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2( 0,-1), 0).rgb).z+
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2( 1, 1), 0).rgb).z+
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2(-1, 1), 0).rgb).z+
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2( 1,-1), 0).rgb).z+
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2(-1,-1), 0).rgb).z;
-
-    color_sharpen_bright=color_sharpen_bright*.125;
-
-    vec3 colorBlurHsb=rgb2hsb(colorBlur.rgb);
-    colorBlurHsb.z-=(sharpenAmount)*color_sharpen_bright;
-
-    //try baking in the sharpenBoost into the amount
-    //this does not work so well over here lol
-    if(sharpenAmount>0){
-        colorBlurHsb.z*=(1.0+sharpenAmount+sharpenBoost);
-    }
-
-    return vec4(hsb2rgb(colorBlurHsb),1.0);
-}
 
 
 vec2 rotate(vec2 coord,float theta,int mode){
@@ -648,9 +596,8 @@ void main()
 	if(ch1GeoOverflow==2){ch1Coords=mirrorCoord1(ch1Coords);}
 
 
-	//add blur and sharpen here
-	vec4 ch1Color=blurAndSharpen(ch1Tex,(ch1Coords/vec2(width,height)),ch1SharpenAmount,ch1SharpenRadius,
-		ch1FiltersBoost,ch1BlurRadius,ch1BlurAmount);
+	//blurred and sharpened ahead of this shader by FilterPrepass
+	vec4 ch1Color=vec4(textureLod(ch1Tex,(ch1Coords/vec2(width,height)),0).rgb,1.0);
 
     //vec4 ch1Color = texture(ch1Tex, ch1Coords/vec2(width,height));
 	//ch1Color.rgb=1.0-ch1Color.rgb;
@@ -776,8 +723,7 @@ void main()
 	if(ch2GeoOverflow==1){ch2Coords=wrapCoord1(ch2Coords);}
 	if(ch2GeoOverflow==2){ch2Coords=mirrorCoord1(ch2Coords);}
 
-	vec4 ch2Color=blurAndSharpen(ch2Tex,(ch2Coords/vec2(width,height)),ch2SharpenAmount,ch2SharpenRadius,
-		ch2FiltersBoost,ch2BlurRadius,ch2BlurAmount);
+	vec4 ch2Color=vec4(textureLod(ch2Tex,(ch2Coords/vec2(width,height)),0).rgb,1.0);
 
 
 	//clamp shits out
@@ -867,9 +813,7 @@ void main()
 
 
 
-	//vec4 blurAndSharpen(sampler2D blurAndSharpenTex, vec2 coord, float sharpenAmount, float sharpenRadius, float sharpenBoost,float blurRadius,float blurAmount)
-	vec4 fb1Color=blurAndSharpen(tex0,(fb1Coords/vec2(width,height)),fb1SharpenAmount,fb1SharpenRadius,
-		fb1FiltersBoost,fb1BlurRadius,fb1BlurAmount);
+	vec4 fb1Color=vec4(scaledTextureLod(tex0,(fb1Coords/vec2(width,height)),fb1Scale).rgb,1.0);
 
 	//vec4 fb1Color=texture(tex0, fb1Coords);
 
@@ -923,7 +867,7 @@ void main()
 		fb1KeySoft,fb1KeyValue,fb1KeyOrder,fb1MixOverflow,vec4(0.0,0.0,0.0,0.0),0);
 
 	//temporal filter
-	vec4 temporalFilter1Color=texture(fb1TemporalFilter,texCoordVarying);
+	vec4 temporalFilter1Color=scaledTextureLod(fb1TemporalFilter,texCoordVarying,fb1TemporalFilterScale);
 	vec3 temporalFilter1ColorHSB=rgb2hsb(temporalFilter1Color.rgb);
 	vec3 temporalFilter2ColorHSB=temporalFilter1ColorHSB;
 
@@ -10,6 +10,9 @@ const float TWO_PI=6.2831855;
 uniform sampler2D block2InputTex;
 uniform sampler2D tex0; //fb2 for now
 uniform sampler2D fb2TemporalFilter;
+uniform vec2 block2InputScale;
+uniform vec2 fb2Scale;
+uniform vec2 fb2TemporalFilterScale;
 
 uniform float ratio;
 uniform float block2AspectRatio;
@@ -46,11 +49,6 @@ uniform float block2InputPosterizeInvert;
 uniform int block2InputPosterizeSwitch;
 uniform float block2InputKaleidoscopeAmount;
 uniform float block2InputKaleidoscopeSlice;
-uniform float block2InputBlurAmount;
-uniform float block2InputBlurRadius;
-uniform float block2InputSharpenAmount;
-uniform float block2InputSharpenRadius;
-uniform float block2InputFiltersBoost;
 
 
 uniform int block2InputHMirror;
@@ -100,15 +98,10 @@ uniform int fb2SaturationInvert;
 uniform int fb2BrightInvert;
 
 //fb2 filters
-uniform	float fb2BlurAmount;
-uniform	float fb2BlurRadius;
-uniform	float fb2SharpenAmount;
-uniform	float fb2SharpenRadius;
 uniform	float fb2TemporalFilter1Amount;
 uniform	float fb2TemporalFilter1Resonance;
 uniform	float fb2TemporalFilter2Amount;
 uniform	float fb2TemporalFilter2Resonance;
-uniform float fb2FiltersBoost;
 
 
 
@@ -116,6 +109,14 @@ in vec2 texCoordVarying;
 
 out vec4 outputColor;
 
+//blocks 1 and 2 render into the lower left of their buffers when the
+//resolution governor steps down, scale is that area's share of the buffer;
+//clamped so filtering never reaches past it
+vec4 scaledTextureLod(sampler2D tex,vec2 coord,vec2 scale){
+	vec2 halfTexel=0.5/vec2(textureSize(tex,0));
+	return textureLod(tex,clamp(coord*scale,halfTexel,scale-halfTexel),0);
+}
+
 //color space conversions
 vec3 rgb2hsb(vec3 c)
 {
@@ -150,53 +151,6 @@ vec3 colorQuantize(vec3 inColor, float amount, float amountInvert){
 	return inColor;
 }
 
-vec4 blurAndSharpen(sampler2D blurAndSharpenTex, vec2 coord,
-		float sharpenAmount, float sharpenRadius, float sharpenBoost,
-		float blurRadius, float blurAmount) {
-	vec4 originalColor = textureLod(blurAndSharpenTex, coord, 0);
-	vec2 texSize = vec2(textureSize(blurAndSharpenTex, 0));
-
-	vec2 blurSize = vec2(blurRadius) / (texSize - vec2(1));
-	vec2 sharpenSize = vec2(sharpenRadius) / (texSize - vec2(1));
-
-	//blur
-	vec4 colorBlur = textureLod(blurAndSharpenTex, coord + blurSize*vec2( 1, 1), 0)
-                  + textureLod(blurAndSharpenTex, coord + blurSize*vec2( 0, 1), 0)
-                  + textureLod(blurAndSharpenTex, coord + blurSize*vec2(-1, 1), 0)
-                  + textureLod(blurAndSharpenTex, coord + blurSize*vec2(-1, 0), 0)
-                  + textureLod(blurAndSharpenTex, coord + blurSize*vec2(-1,-1), 0)
-                  + textureLod(blurAndSharpenTex, coord + blurSize*vec2( 0,-1), 0)
-                  + textureLod(blurAndSharpenTex, coord + blurSize*vec2( 1,-1), 0)
-                  + textureLod(blurAndSharpenTex, coord + blurSize*vec2( 1, 0), 0);
-
-	colorBlur*=.125;
-
-	colorBlur=mix(originalColor,colorBlur,blurAmount);
-
-	//sharpen
-	float color_sharpen_bright =
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2( 1, 0), 0).rgb).z+
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2(-1, 0), 0).rgb).z+
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2( 0, 1), 0).rgb).z+
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2( 0,-1), 0).rgb).z+
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2( 1, 1), 0).rgb).z+
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2(-1, 1), 0).rgb).z+
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2( 1,-1), 0).rgb).z+
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2(-1,-1), 0).rgb).z;
-
-    color_sharpen_bright=color_sharpen_bright*.125;
-
-    vec3 colorBlurHsb=rgb2hsb(colorBlur.rgb);
-    colorBlurHsb.z-=(sharpenAmount)*color_sharpen_bright;
-
-    //try baking in the sharpenBoost into the amount
-    //this does not work so well over here lol
-    if(sharpenAmount>0){
-        colorBlurHsb.z*=(1.0+sharpenAmount+sharpenBoost);
-    }
-
-    return vec4(hsb2rgb(colorBlurHsb),1.0);
-}
 
 vec2 rotate(vec2 coord,float theta,int mode){
 
@@ -656,8 +610,7 @@ void main()
 	if(block2InputGeoOverflow==2){block2InputCoords=mirrorCoord1(block2InputCoords, block2InputWidth,block2InputHeight);}
 
 
-	vec4 block2InputColor=blurAndSharpen(block2InputTex,(block2InputCoords/vec2(width,height)),block2InputSharpenAmount,block2InputSharpenRadius,
-		block2InputFiltersBoost,block2InputBlurRadius,block2InputBlurAmount);
+	vec4 block2InputColor=vec4(scaledTextureLod(block2InputTex,(block2InputCoords/vec2(width,height)),block2InputScale).rgb,1.0);
     //vec4 block2InputColor = texture(block2InputTex, block2InputCoords/vec2(width,height));
 	//block2InputColor.rgb=1.0-block2InputColor.rgb;
 
@@ -744,9 +697,7 @@ void main()
 
 
 
-	//vec4 blurAndSharpen(sampler2D blurAndSharpenTex, vec2 coord, float sharpenAmount, float sharpenRadius, float sharpenBoost,float blurRadius,float blurAmount)
-	vec4 fb2Color=blurAndSharpen(tex0,(fb2Coords/vec2(width,height)),fb2SharpenAmount,fb2SharpenRadius,
-		fb2FiltersBoost,fb2BlurRadius,fb2BlurAmount);
+	vec4 fb2Color=vec4(scaledTextureLod(tex0,(fb2Coords/vec2(width,height)),fb2Scale).rgb,1.0);
 
 	//vec4 fb2Color=texture(tex0, fb2Coords/vec2(width,height));
 
@@ -795,7 +746,7 @@ void main()
 	//temporal filter
 	//experiment more with temporal filter displacement
 	//vec4 temporalFilter1Color=texture(fb2TemporalFilter,texCoordVarying+vec2(.01,.01));
-	vec4 temporalFilter1Color=texture(fb2TemporalFilter,texCoordVarying);
+	vec4 temporalFilter1Color=scaledTextureLod(fb2TemporalFilter,texCoordVarying,fb2TemporalFilterScale);
 	vec3 temporalFilter1ColorHSB=rgb2hsb(temporalFilter1Color.rgb);
 	vec3 temporalFilter2ColorHSB=temporalFilter1ColorHSB;
 
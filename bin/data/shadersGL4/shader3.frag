@@ -6,6 +6,8 @@ const float TWO_PI=6.2831855;
 
 uniform sampler2D block2Output;
 uniform sampler2D block1Output;
+uniform vec2 block2Scale;
+uniform vec2 block1Scale;
 
 uniform float ratio;
 
@@ -32,18 +34,10 @@ uniform int block1VFlip;
 //block1 colorize
 uniform int block1ColorizeSwitch;
 uniform int block1ColorizeHSB_RGB;
-uniform vec3 block1ColorizeBand1;
-uniform vec3 block1ColorizeBand2;
-uniform vec3 block1ColorizeBand3;
-uniform vec3 block1ColorizeBand4;
-uniform vec3 block1ColorizeBand5;
+//5 bands baked against brightness, see ColorizeLut
+uniform sampler2D block1ColorizeLut;
 
 //block1 filters
-uniform	float block1BlurAmount;
-uniform	float block1BlurRadius;
-uniform	float block1SharpenAmount;
-uniform	float block1SharpenRadius;
-uniform float block1FiltersBoost;
 uniform float block1Dither;
 uniform int block1DitherSwitch;
 uniform int block1DitherType;
@@ -65,18 +59,10 @@ uniform int block2VFlip;
 //block2 colorize
 uniform int block2ColorizeSwitch;
 uniform int block2ColorizeHSB_RGB;
-uniform vec3 block2ColorizeBand1;
-uniform vec3 block2ColorizeBand2;
-uniform vec3 block2ColorizeBand3;
-uniform vec3 block2ColorizeBand4;
-uniform vec3 block2ColorizeBand5;
+//5 bands baked against brightness, see ColorizeLut
+uniform sampler2D block2ColorizeLut;
 
 //block2 filters
-uniform	float block2BlurAmount;
-uniform	float block2BlurRadius;
-uniform	float block2SharpenAmount;
-uniform	float block2SharpenRadius;
-uniform float block2FiltersBoost;
 uniform float block2Dither;
 uniform int block2DitherSwitch;
 uniform int block2DitherType;
@@ -106,6 +92,14 @@ in vec2 texCoordVarying;
 
 out vec4 outputColor;
 
+//blocks 1 and 2 render into the lower left of their buffers when the
+//resolution governor steps down, scale is that area's share of the buffer;
+//clamped so filtering never reaches past it
+vec4 scaledTextureLod(sampler2D tex,vec2 coord,vec2 scale){
+	vec2 halfTexel=0.5/vec2(textureSize(tex,0));
+	return textureLod(tex,clamp(coord*scale,halfTexel,scale-halfTexel),0);
+}
+
 //color space conversions
 vec3 rgb2hsb(vec3 c)
 {
@@ -410,53 +404,6 @@ float dither2(float inColor,vec2 inCoord,float ditherPalette,int ditherType){
 	return (colorDiff < indexValue) ? closestColor : secondClosestColor;
 }
 
-vec4 blurAndSharpen(sampler2D blurAndSharpenTex, vec2 coord,
-		float sharpenAmount, float sharpenRadius, float sharpenBoost,
-		float blurRadius, float blurAmount) {
-	vec4 originalColor = textureLod(blurAndSharpenTex, coord, 0);
-	vec2 texSize = vec2(textureSize(blurAndSharpenTex, 0));
-
-	vec2 blurSize = vec2(blurRadius) / (texSize - vec2(1));
-	vec2 sharpenSize = vec2(sharpenRadius) / (texSize - vec2(1));
-
-	//blur
-	vec4 colorBlur = textureLod(blurAndSharpenTex, coord + blurSize*vec2( 1, 1), 0)
-                  + textureLod(blurAndSharpenTex, coord + blurSize*vec2( 0, 1), 0)
-                  + textureLod(blurAndSharpenTex, coord + blurSize*vec2(-1, 1), 0)
-                  + textureLod(blurAndSharpenTex, coord + blurSize*vec2(-1, 0), 0)
-                  + textureLod(blurAndSharpenTex, coord + blurSize*vec2(-1,-1), 0)
-                  + textureLod(blurAndSharpenTex, coord + blurSize*vec2( 0,-1), 0)
-                  + textureLod(blurAndSharpenTex, coord + blurSize*vec2( 1,-1), 0)
-                  + textureLod(blurAndSharpenTex, coord + blurSize*vec2( 1, 0), 0);
-
-	colorBlur*=.125;
-
-	colorBlur=mix(originalColor,colorBlur,blurAmount);
-
-	//sharpen
-	float color_sharpen_bright =
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2( 1, 0), 0).rgb).z+
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2(-1, 0), 0).rgb).z+
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2( 0, 1), 0).rgb).z+
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2( 0,-1), 0).rgb).z+
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2( 1, 1), 0).rgb).z+
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2(-1, 1), 0).rgb).z+
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2( 1,-1), 0).rgb).z+
-		rgb2hsb(textureLod(blurAndSharpenTex, coord + sharpenSize*vec2(-1,-1), 0).rgb).z;
-
-    color_sharpen_bright=color_sharpen_bright*.125;
-
-    vec3 colorBlurHsb=rgb2hsb(colorBlur.rgb);
-    colorBlurHsb.z-=(sharpenAmount)*color_sharpen_bright;
-
-    //try baking in the sharpenBoost into the amount
-    //this does not work so well over here lol
-    if(sharpenAmount>0){
-        colorBlurHsb.z*=(1.0+sharpenAmount+sharpenBoost);
-    }
-
-    return vec4(hsb2rgb(colorBlurHsb),1.0);
-}
 
 
 void main()
@@ -498,8 +445,7 @@ void main()
 
 
 
-	vec4 block1Color=blurAndSharpen(block1Output,(block1Coords/vec2(width,height)),block1SharpenAmount,block1SharpenRadius,
-		block1FiltersBoost,block1BlurRadius,block1BlurAmount);
+	vec4 block1Color=vec4(scaledTextureLod(block1Output,(block1Coords/vec2(width,height)),block1Scale).rgb,1.0);
 
 	if(block1GeoOverflow==0){
 		if(block1Coords.x>width || block1Coords.y> height || block1Coords.x<0.0 || block1Coords.y<0.0){
@@ -509,57 +455,11 @@ void main()
 
 	//vec4 block1Color=texture(block1Output, block1Coords/vec2(width,height));
 
-	vec3 block1ColorHSB=rgb2hsb(block1Color.rgb);
-
 	//BLOCK1 COLORIZE
 	if(block1ColorizeSwitch==1){
-		vec3 colorizedRGB=vec3(0.0,0.0,0.0);
-		vec3 colorizedRGB1=vec3(0.0,0.0,0.0);
-		vec3 colorizedRGB2=vec3(0.0,0.0,0.0);
-		vec3 colorizedRGB3=vec3(0.0,0.0,0.0);
-		vec3 colorizedRGB4=vec3(0.0,0.0,0.0);
-		vec3 colorizedRGB5=vec3(0.0,0.0,0.0);
-
-
-		if(block1ColorizeHSB_RGB==0){
-			//assign bands
-			vec3 colorizedHSB1=block1ColorizeBand1+vec3(0.0,0.0,block1ColorHSB.z);
-			vec3 colorizedHSB2=block1ColorizeBand2+vec3(0.0,0.0,block1ColorHSB.z);
-			vec3 colorizedHSB3=block1ColorizeBand3+vec3(0.0,0.0,block1ColorHSB.z);
-			vec3 colorizedHSB4=block1ColorizeBand4+vec3(0.0,0.0,block1ColorHSB.z);
-			vec3 colorizedHSB5=block1ColorizeBand5+vec3(0.0,0.0,block1ColorHSB.z);
-
-			//convert to rgb
-			colorizedRGB1=hsb2rgb(colorizedHSB1);
-			colorizedRGB2=hsb2rgb(colorizedHSB2);
-			colorizedRGB3=hsb2rgb(colorizedHSB3);
-			colorizedRGB4=hsb2rgb(colorizedHSB4);
-			colorizedRGB5=hsb2rgb(colorizedHSB5);
-
-		}
-
-		if(block1ColorizeHSB_RGB==1){
-			colorizedRGB1=block1ColorizeBand1+block1Color.rgb;
-			colorizedRGB2=block1ColorizeBand2+block1Color.rgb;
-			colorizedRGB3=block1ColorizeBand3+block1Color.rgb;
-			colorizedRGB4=block1ColorizeBand4+block1Color.rgb;
-			colorizedRGB5=block1ColorizeBand5+block1Color.rgb;
-
-		}
-
-		if(block1ColorHSB.z<.25){
-			colorizedRGB=mix(colorizedRGB1,colorizedRGB2,block1ColorHSB.z*4.0);
-		}
-		if(block1ColorHSB.z>.25 && block1ColorHSB.z<.5){
-			colorizedRGB=mix(colorizedRGB2,colorizedRGB3,(block1ColorHSB.z-.25)*4.0);
-		}
-		if(block1ColorHSB.z>.5 && block1ColorHSB.z<.75){
-			colorizedRGB=mix(colorizedRGB3,colorizedRGB4,(block1ColorHSB.z-.5)*4.0);
-		}
-		if(block1ColorHSB.z>.75){
-			colorizedRGB=mix(colorizedRGB4,colorizedRGB5,(block1ColorHSB.z-.75)*4.0);
-		}
-
+		float bright=max(block1Color.r,max(block1Color.g,block1Color.b));
+		vec3 colorizedRGB=textureLod(block1ColorizeLut,vec2(bright*(255.0/256.0)+0.5/256.0,0.5),0).rgb;
+		if(block1ColorizeHSB_RGB==1){colorizedRGB+=block1Color.rgb;}
 		block1Color.rgb=colorizedRGB;
 	}
 
@@ -614,8 +514,7 @@ void main()
 
 
 
-	vec4 block2Color=blurAndSharpen(block2Output,(block2Coords/vec2(width,height)),block2SharpenAmount,block2SharpenRadius,
-		block2FiltersBoost,block2BlurRadius,block2BlurAmount);
+	vec4 block2Color=vec4(scaledTextureLod(block2Output,(block2Coords/vec2(width,height)),block2Scale).rgb,1.0);
 
 	if(block2GeoOverflow==0){
 		if(block2Coords.x>width || block2Coords.y> height || block2Coords.x<0.0 || block2Coords.y<0.0){
@@ -628,58 +527,11 @@ void main()
 
 
 
-	vec3 block2ColorHSB=rgb2hsb(block2Color.rgb);
-
 	//block2 COLORIZE
 	if(block2ColorizeSwitch==1){
-		vec3 colorizedRGB=vec3(0.0,0.0,0.0);
-
-		vec3 colorizedRGB1=vec3(0.0,0.0,0.0);
-		vec3 colorizedRGB2=vec3(0.0,0.0,0.0);
-		vec3 colorizedRGB3=vec3(0.0,0.0,0.0);
-		vec3 colorizedRGB4=vec3(0.0,0.0,0.0);
-		vec3 colorizedRGB5=vec3(0.0,0.0,0.0);
-
-
-		if(block2ColorizeHSB_RGB==0){
-			//assign bands
-			vec3 colorizedHSB1=block2ColorizeBand1+vec3(0.0,0.0,block2ColorHSB.z);
-			vec3 colorizedHSB2=block2ColorizeBand2+vec3(0.0,0.0,block2ColorHSB.z);
-			vec3 colorizedHSB3=block2ColorizeBand3+vec3(0.0,0.0,block2ColorHSB.z);
-			vec3 colorizedHSB4=block2ColorizeBand4+vec3(0.0,0.0,block2ColorHSB.z);
-			vec3 colorizedHSB5=block2ColorizeBand5+vec3(0.0,0.0,block2ColorHSB.z);
-
-			//convert to rgb
-			colorizedRGB1=hsb2rgb(colorizedHSB1);
-			colorizedRGB2=hsb2rgb(colorizedHSB2);
-			colorizedRGB3=hsb2rgb(colorizedHSB3);
-			colorizedRGB4=hsb2rgb(colorizedHSB4);
-			colorizedRGB5=hsb2rgb(colorizedHSB5);
-
-		}
-
-		if(block2ColorizeHSB_RGB==1){
-			colorizedRGB1=block2ColorizeBand1+block2Color.rgb;
-			colorizedRGB2=block2ColorizeBand2+block2Color.rgb;
-			colorizedRGB3=block2ColorizeBand3+block2Color.rgb;
-			colorizedRGB4=block2ColorizeBand4+block2Color.rgb;
-			colorizedRGB5=block2ColorizeBand5+block2Color.rgb;
-
-		}
-
-		if(block2ColorHSB.z<.25){
-			colorizedRGB=mix(colorizedRGB1,colorizedRGB2,block2ColorHSB.z*4.0);
-		}
-		if(block2ColorHSB.z>.25 && block2ColorHSB.z<.5){
-			colorizedRGB=mix(colorizedRGB2,colorizedRGB3,(block2ColorHSB.z-.25)*4.0);
-		}
-		if(block2ColorHSB.z>.5 && block2ColorHSB.z<.75){
-			colorizedRGB=mix(colorizedRGB3,colorizedRGB4,(block2ColorHSB.z-.5)*4.0);
-		}
-		if(block2ColorHSB.z>.75){
-			colorizedRGB=mix(colorizedRGB4,colorizedRGB5,(block2ColorHSB.z-.75)*4.0);
-		}
-
+		float bright=max(block2Color.r,max(block2Color.g,block2Color.b));
+		vec3 colorizedRGB=textureLod(block2ColorizeLut,vec2(bright*(255.0/256.0)+0.5/256.0,0.5),0).rgb;
+		if(block2ColorizeHSB_RGB==1){colorizedRGB+=block2Color.rgb;}
 		block2Color.rgb=colorizedRGB;
 	}
 	//dither
@@ -0,0 +1,78 @@
+#version 460
+
+// Upscale from a block's render area to the output resolution, run by
+// Upscaler between the block outputs and shader3.
+//
+// mode 1: Lanczos 2 over the 4x4 source texels around each output pixel,
+// clamped to the range of the nearest 2x2 so edges don't ring.
+// mode 2: as 1, then contrast adaptive sharpening (after AMD's CAS): the
+// sharpening backs off where the neighbourhood is already contrasty, so
+// edges crisp up without halos and flat areas don't pick up noise.
+
+const float PI=3.1415926535;
+
+uniform sampler2D tex0;
+uniform vec2 sourceScale;       // share of tex0 the block rendered into
+uniform int mode;
+uniform float sharpness;        // 0 - 1, mode 2 only
+
+in vec2 texCoordVarying;
+
+out vec4 outputColor;
+
+float lanczos2(float x)
+{
+	x=abs(x);
+	if(x<1.0e-5) return 1.0;
+	if(x>=2.0) return 0.0;
+	float px=PI*x;
+	return 2.0*sin(px)*sin(px*0.5)/(px*px);
+}
+
+void main()
+{
+	vec2 size=vec2(textureSize(tex0,0));
+	ivec2 lastTexel=ivec2(round(size*sourceScale))-1;
+	vec2 position=texCoordVarying*size*sourceScale-0.5;
+	vec2 base=floor(position);
+	vec2 f=position-base;
+
+	vec3 sum=vec3(0.0);
+	float weightSum=0.0;
+	vec3 nearestMin=vec3(1.0e9);
+	vec3 nearestMax=vec3(-1.0e9);
+	for(int y=-1;y<=2;y++){
+		float weightY=lanczos2(float(y)-f.y);
+		for(int x=-1;x<=2;x++){
+			float weight=lanczos2(float(x)-f.x)*weightY;
+			vec3 c=texelFetch(tex0,clamp(ivec2(base)+ivec2(x,y),ivec2(0),lastTexel),0).rgb;
+			sum+=c*weight;
+			weightSum+=weight;
+			if(x>=0 && x<=1 && y>=0 && y<=1){
+				nearestMin=min(nearestMin,c);
+				nearestMax=max(nearestMax,c);
+			}
+		}
+	}
+	vec3 color=clamp(sum/weightSum,nearestMin,nearestMax);
+
+	if(mode==2){
+		// Cross one source texel out, kept inside the render area
+		vec2 texel=1.0/size;
+		vec2 uv=texCoordVarying*sourceScale;
+		vec2 low=texel*0.5;
+		vec2 high=sourceScale-texel*0.5;
+		vec3 n=textureLod(tex0,clamp(uv+vec2(0.0,texel.y),low,high),0).rgb;
+		vec3 s=textureLod(tex0,clamp(uv-vec2(0.0,texel.y),low,high),0).rgb;
+		vec3 e=textureLod(tex0,clamp(uv+vec2(texel.x,0.0),low,high),0).rgb;
+		vec3 w=textureLod(tex0,clamp(uv-vec2(texel.x,0.0),low,high),0).rgb;
+
+		vec3 crossMin=min(color,min(min(n,s),min(e,w)));
+		vec3 crossMax=max(color,max(max(n,s),max(e,w)));
+		vec3 amplitude=sqrt(clamp(min(crossMin,1.0-crossMax)/max(crossMax,1.0e-5),0.0,1.0));
+		vec3 weight=-amplitude/mix(8.0,5.0,sharpness);
+		color=clamp((color+(n+s+e+w)*weight)/(1.0+4.0*weight),0.0,1.0);
+	}
+
+	outputColor=vec4(color,1.0);
+}
@@ -0,0 +1,274 @@
+#include "CachedShader.h"
+#include "glm/gtc/type_ptr.hpp"
+
+namespace {
+
+	const uint32_t CACHE_MAGIC = 0x31435347;    // "GSC1"
+
+	struct CacheHeader {
+		uint32_t magic;
+		GLenum format;
+		uint64_t key;
+	};
+
+	struct QuadVertex {
+		glm::vec3 position;
+		glm::vec2 texcoord;
+	};
+
+	// FNV-1a, unlike std::hash the same from build to build
+	uint64_t hash(const std::string& text, uint64_t h = 14695981039346656037ull) {
+		for (unsigned char c : text) {
+			h ^= c;
+			h *= 1099511628211ull;
+		}
+		return h;
+	}
+
+	std::string glString(GLenum name) {
+		const char* text = reinterpret_cast<const char*>(glGetString(name));
+		return text ? text : "";
+	}
+
+	GLuint compile(GLenum type, const std::string& source) {
+		GLuint shader = glCreateShader(type);
+		const char* text = source.c_str();
+		glShaderSource(shader, 1, &text, nullptr);
+		glCompileShader(shader);
+		return shader;
+	}
+
+	void useCompilerThreads() {
+		static bool requested = false;
+		if (requested) return;
+		requested = true;
+#if defined(GL_ARB_parallel_shader_compile) && !defined(TARGET_OPENGLES)
+		if (GLEW_ARB_parallel_shader_compile) {
+			glMaxShaderCompilerThreadsARB(0xFFFFFFFF);      // as many as the driver likes
+		}
+#endif
+	}
+
+}
+
+//--------------------------------------------------------------
+bool CachedShader::load(const std::string& shaderPath) {
+	shaderName = ofFilePath::getFileName(shaderPath);
+	ofBuffer vert = ofBufferFromFile(shaderPath + ".vert");
+	ofBuffer frag = ofBufferFromFile(shaderPath + ".frag");
+	if (vert.size() == 0 || frag.size() == 0) {
+		ofLogError("Shader") << shaderName << " sources not found at " << shaderPath;
+		return false;
+	}
+
+	std::string driver = glString(GL_VENDOR) + "\n" + glString(GL_RENDERER) + "\n" + glString(GL_VERSION) + "\n";
+	key = hash(frag.getText(), hash(vert.getText(), hash(driver)));
+	cachePath = "shaderCache/" + shaderName + ".bin";
+
+	if (program != 0) glDeleteProgram(program);
+	program = glCreateProgram();
+	locations.clear();
+	loaded = false;
+
+	if (loadBinary()) {
+		ofLogNotice("Shader") << shaderName << " loaded from the program cache";
+		loaded = true;
+		return true;
+	}
+
+	useCompilerThreads();
+	shaders[0] = compile(GL_VERTEX_SHADER, vert.getText());
+	shaders[1] = compile(GL_FRAGMENT_SHADER, frag.getText());
+	for (GLuint shader : shaders) {
+		glAttachShader(program, shader);
+	}
+	// Where ofShader puts them, so cached binaries from either agree
+	glBindAttribLocation(program, ofShader::POSITION_ATTRIBUTE, "position");
+	glBindAttribLocation(program, ofShader::TEXCOORD_ATTRIBUTE, "texcoord");
+#ifndef TARGET_OPENGLES
+	glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
+	glLinkProgram(program);
+	pending = true;
+	return true;
+}
+
+//--------------------------------------------------------------
+bool CachedShader::isLoaded() {
+	return finish();
+}
+
+//--------------------------------------------------------------
+bool CachedShader::finish() {
+	if (!pending) return loaded;
+	pending = false;
+
+	GLint status = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &status);
+	if (status != GL_TRUE) {
+		for (GLuint shader : shaders) {
+			GLint length = 0;
+			glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &length);
+			if (length > 1) {
+				std::string log(length, '\0');
+				glGetShaderInfoLog(shader, length, nullptr, &log[0]);
+				ofLogError("Shader") << shaderName << ": " << log;
+			}
+		}
+		GLint length = 0;
+		glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length);
+		if (length > 1) {
+			std::string log(length, '\0');
+			glGetProgramInfoLog(program, length, nullptr, &log[0]);
+			ofLogError("Shader") << shaderName << " failed to link: " << log;
+		}
+	}
+
+	for (GLuint& shader : shaders) {
+		glDetachShader(program, shader);
+		glDeleteShader(shader);
+		shader = 0;
+	}
+
+	loaded = status == GL_TRUE;
+	if (loaded) saveBinary();
+	return loaded;
+}
+
+//--------------------------------------------------------------
+bool CachedShader::loadBinary() {
+#ifdef TARGET_OPENGLES
+	return false;
+#else
+	if (!ofFile::doesFileExist(cachePath)) return false;
+	ofBuffer buffer = ofBufferFromFile(cachePath, true);
+	if (buffer.size() <= sizeof(CacheHeader)) return false;
+
+	CacheHeader header;
+	memcpy(&header, buffer.getData(), sizeof(header));
+	if (header.magic != CACHE_MAGIC || header.key != key) return false;
+
+	glProgramBinary(program, header.format, buffer.getData() + sizeof(header), GLsizei(buffer.size() - sizeof(header)));
+	// Drivers may still refuse a binary they wrote; the program is then linked from source
+	GLint status = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &status);
+	return status == GL_TRUE;
+#endif
+}
+
+//--------------------------------------------------------------
+void CachedShader::saveBinary() {
+#ifndef TARGET_OPENGLES
+	GLint formats = 0;
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+	GLint length = 0;
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (formats == 0 || length <= 0) return;
+
+	CacheHeader header = { CACHE_MAGIC, 0, key };
+	std::vector<char> data(sizeof(header) + length);
+	glGetProgramBinary(program, length, &length, &header.format, data.data() + sizeof(header));
+	memcpy(data.data(), &header, sizeof(header));
+
+	ofFilePath::createEnclosingDirectory(cachePath);
+	if (!ofBufferToFile(cachePath, ofBuffer(data.data(), sizeof(header) + length), true)) {
+		ofLogWarning("Shader") << shaderName << " could not be written to the program cache";
+	}
+#endif
+}
+
+//--------------------------------------------------------------
+void CachedShader::begin() {
+	if (!finish()) return;
+	glGetIntegerv(GL_CURRENT_PROGRAM, &previousProgram);
+	glUseProgram(program);
+}
+
+//--------------------------------------------------------------
+void CachedShader::end() {
+	if (!loaded) return;
+	// openFrameworks tracks its bound program itself, so put back what it expects
+	glUseProgram(previousProgram);
+}
+
+//--------------------------------------------------------------
+void CachedShader::draw(const ofTexture& texture, float x, float y, float w, float h) {
+	if (!loaded) return;
+
+	if (vao == 0) {
+		glGenVertexArrays(1, &vao);
+		glGenBuffers(1, &vbo);
+		glBindVertexArray(vao);
+		glBindBuffer(GL_ARRAY_BUFFER, vbo);
+		glBufferData(GL_ARRAY_BUFFER, 4 * sizeof(QuadVertex), nullptr, GL_DYNAMIC_DRAW);
+		glEnableVertexAttribArray(ofShader::POSITION_ATTRIBUTE);
+		glVertexAttribPointer(ofShader::POSITION_ATTRIBUTE, 3, GL_FLOAT, GL_FALSE, sizeof(QuadVertex), (void*)offsetof(QuadVertex, position));
+		glEnableVertexAttribArray(ofShader::TEXCOORD_ATTRIBUTE);
+		glVertexAttribPointer(ofShader::TEXCOORD_ATTRIBUTE, 2, GL_FLOAT, GL_FALSE, sizeof(QuadVertex), (void*)offsetof(QuadVertex, texcoord));
+		glBindVertexArray(0);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+	// The same quad, flip and texture coordinates ofTexture::draw would use
+	ofMesh quad = texture.getMeshForSubsection(x, y, 0, w, h, 0, 0, texture.getWidth(), texture.getHeight(),
+		ofIsVFlipped(), ofGetRectMode());
+	QuadVertex vertices[4];
+	for (int i = 0; i < 4; i++) {
+		vertices[i] = { quad.getVertex(i), quad.getTexCoord(i) };
+	}
+	glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	glm::mat4 modelViewProjection = ofGetCurrentMatrix(OF_MATRIX_PROJECTION) * ofGetCurrentMatrix(OF_MATRIX_MODELVIEW);
+	glUniformMatrix4fv(location("modelViewProjectionMatrix"), 1, GL_FALSE, glm::value_ptr(modelViewProjection));
+	setUniformTexture("tex0", texture, 0);
+
+	glBindVertexArray(vao);
+	glDrawArrays(ofGetGLPrimitiveMode(quad.getMode()), 0, 4);
+	glBindVertexArray(0);
+}
+
+//--------------------------------------------------------------
+void CachedShader::setUniform1i(const std::string& name, int v) {
+	if (loaded) glUniform1i(location(name), v);
+}
+
+//--------------------------------------------------------------
+void CachedShader::setUniform1f(const std::string& name, float v) {
+	if (loaded) glUniform1f(location(name), v);
+}
+
+//--------------------------------------------------------------
+void CachedShader::setUniform2f(const std::string& name, float v1, float v2) {
+	if (loaded) glUniform2f(location(name), v1, v2);
+}
+
+//--------------------------------------------------------------
+void CachedShader::setUniform3f(const std::string& name, float v1, float v2, float v3) {
+	if (loaded) glUniform3f(location(name), v1, v2, v3);
+}
+
+//--------------------------------------------------------------
+void CachedShader::setUniform4f(const std::string& name, float v1, float v2, float v3, float v4) {
+	if (loaded) glUniform4f(location(name), v1, v2, v3, v4);
+}
+
+//--------------------------------------------------------------
+void CachedShader::setUniformTexture(const std::string& name, const ofTexture& texture, int unit) {
+	if (!loaded) return;
+	const ofTextureData& data = texture.getTextureData();
+	glActiveTexture(GL_TEXTURE0 + unit);
+	glBindTexture(data.textureTarget, data.textureID);
+	glActiveTexture(GL_TEXTURE0);
+	glUniform1i(location(name), unit);
+}
+
+//--------------------------------------------------------------
+GLint CachedShader::location(const std::string& name) {
+	auto it = locations.find(name);
+	if (it == locations.end()) {
+		it = locations.emplace(name, glGetUniformLocation(program, name.c_str())).first;
+	}
+	return it->second;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "ofMain.h"
+
+// Vertex / fragment program that keeps its linked binary in
+// bin/data/shaderCache, so later starts skip compiling and linking. The
+// cache key is the GL vendor, renderer and version strings plus a hash of
+// both sources; a driver update or an edited shader just misses and the
+// binary is rewritten.
+//
+// On a miss the compile and link are started in load() and only waited on
+// at the first begin(). With GL_ARB_parallel_shader_compile the driver
+// runs them on its own threads in the meantime, so several programs load
+// side by side with the rest of setup.
+//
+// Covers the part of ofShader the block shaders use. openFrameworks can't
+// draw through a program it didn't link, so the full frame quad is drawn
+// with draw() instead of ofTexture::draw().
+class CachedShader {
+public:
+	// shaderPath.vert and shaderPath.frag, relative to bin/data
+	bool load(const std::string& shaderPath);
+	bool isLoaded();
+
+	void begin();
+	void end();
+	// As texture.draw(x, y, w, h) between begin() and end(), with texture as tex0
+	void draw(const ofTexture& texture, float x, float y, float w, float h);
+
+	void setUniform1i(const std::string& name, int v);
+	void setUniform1f(const std::string& name, float v);
+	void setUniform2f(const std::string& name, float v1, float v2);
+	void setUniform3f(const std::string& name, float v1, float v2, float v3);
+	void setUniform4f(const std::string& name, float v1, float v2, float v3, float v4);
+	void setUniformTexture(const std::string& name, const ofTexture& texture, int unit);
+
+private:
+	bool loadBinary();
+	void saveBinary();
+	// Waits for a pending link and checks it
+	bool finish();
+	GLint location(const std::string& name);
+
+	std::string shaderName;
+	std::string cachePath;
+	uint64_t key = 0;
+	GLuint program = 0;
+	GLuint shaders[2] = {};         // until a pending link is finished
+	bool pending = false;
+	bool loaded = false;
+	GLint previousProgram = 0;
+	GLuint vao = 0;                 // the quad for draw(), made on first use
+	GLuint vbo = 0;
+	std::unordered_map<std::string, GLint> locations;
+};
@@ -0,0 +1,57 @@
+#include "ColorizeLut.h"
+
+namespace {
+
+	// hsb2rgb from shader3.frag, hue wrapped and nothing clamped
+	glm::vec3 hsb2rgb(const glm::vec3& c) {
+		glm::vec3 rgb;
+		for (int i = 0; i < 3; i++) {
+			float h = c.x + (3 - i) / 3.0f;
+			float p = std::abs((h - std::floor(h)) * 6.0f - 3.0f);
+			rgb[i] = c.z * glm::mix(1.0f, ofClamp(p - 1.0f, 0.0f, 1.0f), c.y);
+		}
+		return rgb;
+	}
+
+}
+
+//--------------------------------------------------------------
+void ColorizeLut::setup() {
+	pixels.allocate(SIZE, 1, OF_PIXELS_RGBA);
+	for (auto& lut : luts) {
+		lut.allocate(SIZE, 1, GL_RGBA32F);     // bands push colours outside 0 - 1
+		lut.setTextureMinMagFilter(GL_LINEAR, GL_LINEAR);
+		lut.setTextureWrap(GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE);
+	}
+}
+
+//--------------------------------------------------------------
+const ofTexture& ColorizeLut::update(int block, const Settings& settings) {
+	if (!valid[block] || !(baked[block] == settings)) {
+		bake(block, settings);
+		baked[block] = settings;
+		valid[block] = true;
+	}
+	return luts[block];
+}
+
+//--------------------------------------------------------------
+void ColorizeLut::bake(int block, const Settings& settings) {
+	for (int i = 0; i < SIZE; i++) {
+		float bright = i / float(SIZE - 1);
+
+		// Four segments between the five bands, a quarter of the brightness range each
+		int band = std::min(int(bright * 4.0f), BANDS - 2);
+		float amount = bright * 4.0f - band;
+
+		glm::vec3 from = settings.bands[band];
+		glm::vec3 to = settings.bands[band + 1];
+		if (settings.hsb) {
+			from = hsb2rgb(from + glm::vec3(0, 0, bright));
+			to = hsb2rgb(to + glm::vec3(0, 0, bright));
+		}
+		glm::vec3 color = glm::mix(from, to, amount);
+		pixels.setColor(i, 0, ofFloatColor(color.r, color.g, color.b, 1.0f));
+	}
+	luts[block].loadData(pixels);
+}
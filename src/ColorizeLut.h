@@ -0,0 +1,42 @@
+#pragma once
+
+#include "ofMain.h"
+
+// The 5-band colorize of Block 3, baked into a 256x1 float texture per
+// block. shader3 only ever colorizes as a function of brightness, so one
+// fetch at the pixel's brightness replaces the per-pixel band mixing. The
+// table is rebuilt on the CPU only when the bands or the mode change.
+//
+// In HSB mode a texel holds the final colour. In RGB mode it holds the mix
+// of the bands, which shader3 adds to the pixel's own colour.
+class ColorizeLut {
+public:
+	static const int BLOCKS = 2;
+	static const int SIZE = 256;    // one texel per 8 bit brightness level
+	static const int BANDS = 5;
+
+	struct Settings {
+		glm::vec3 bands[BANDS];     // hue, saturation, brightness offsets
+		bool hsb = true;            // block*ColorizeHSB_RGB == 0
+
+		bool operator==(const Settings& other) const {
+			if (hsb != other.hsb) return false;
+			for (int i = 0; i < BANDS; i++) {
+				if (bands[i] != other.bands[i]) return false;
+			}
+			return true;
+		}
+	};
+
+	void setup();
+	// The block's table, rebaked first if settings differ from the last call
+	const ofTexture& update(int block, const Settings& settings);
+
+private:
+	void bake(int block, const Settings& settings);
+
+	ofTexture luts[BLOCKS];
+	ofFloatPixels pixels;
+	Settings baked[BLOCKS];
+	bool valid[BLOCKS] = {};
+};
@@ -0,0 +1,146 @@
+#include "FilterPrepass.h"
+
+//--------------------------------------------------------------
+bool FilterPrepass::setup(const std::string& shaderDir) {
+	loaded = shader.load(shaderDir + "/filter");
+	if (!loaded) ofLogError("Shader") << "Filter shader failed to load, blur and sharpen are disabled";
+
+	computeLoaded = computeShader.setupShaderFromFile(GL_COMPUTE_SHADER, shaderDir + "/filter.comp")
+		&& computeShader.linkProgram();
+	if (!computeLoaded) ofLogWarning("Shader") << "Compute filter shader failed to load, using the fragment path";
+	return loaded;
+}
+
+//--------------------------------------------------------------
+void FilterPrepass::setUseCompute(bool use) {
+	useCompute = use && computeLoaded;
+}
+
+//--------------------------------------------------------------
+void FilterPrepass::beginFrame() {
+	used = 0;
+}
+
+//--------------------------------------------------------------
+const ofTexture& FilterPrepass::apply(const ofTexture& source, const Settings& settings) {
+	if (!(useCompute ? computeLoaded : loaded) || !source.isAllocated()) return source;
+	if (settings.blurAmount <= 0 && settings.sharpenAmount <= 0) return source;
+
+	const ofTextureData& data = source.getTextureData();
+	for (size_t i = 0; i < used; i++) {
+		if (entries[i].sourceId == data.textureID && entries[i].settings == settings) {
+			return entries[i].result.getTexture();
+		}
+	}
+
+	if (used == entries.size()) entries.emplace_back();
+	Entry& entry = entries[used++];
+	entry.sourceId = data.textureID;
+	entry.settings = settings;
+
+	int width = (int)source.getWidth();
+	int height = (int)source.getHeight();
+	if (!entry.result.isAllocated() || entry.result.getWidth() != width || entry.result.getHeight() != height) {
+		ofFboSettings fboSettings;
+		fboSettings.width = width;
+		fboSettings.height = height;
+		fboSettings.useDepth = false;
+		fboSettings.useStencil = false;
+		fboSettings.internalformat = GL_RGBA8;      // also the image format filter.comp writes
+		entry.result.allocate(fboSettings);
+	}
+
+	if (useCompute) {
+		renderCompute(source, entry);
+	} else {
+		renderFragment(source, entry);
+	}
+	return entry.result.getTexture();
+}
+
+//--------------------------------------------------------------
+void FilterPrepass::renderFragment(const ofTexture& source, Entry& entry) {
+	const Settings& settings = entry.settings;
+	const ofTextureData& data = source.getTextureData();
+	int width = (int)source.getWidth();
+	int height = (int)source.getHeight();
+
+	// Only this path needs the intermediate, so compute never allocates it
+	if (!entry.horizontal.isAllocated() || entry.horizontal.getWidth() != width || entry.horizontal.getHeight() != height) {
+		ofFboSettings fboSettings;
+		fboSettings.width = width;
+		fboSettings.height = height;
+		fboSettings.useDepth = false;
+		fboSettings.useStencil = false;
+		fboSettings.internalformat = GL_RGBA16F;    // brightness in alpha, kept unclamped
+		entry.horizontal.allocate(fboSettings);
+	}
+
+	// Taps more than a texel apart read a coarser mip level
+	bool useMips = std::max(std::abs(settings.blurRadius), std::abs(settings.sharpenRadius)) * 0.25f > 1.0f;
+	if (useMips) {
+		glBindTexture(data.textureTarget, data.textureID);
+		glGenerateMipmap(data.textureTarget);
+		glTexParameteri(data.textureTarget, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+		glBindTexture(data.textureTarget, 0);
+	}
+
+	ofPushStyle();
+	ofDisableAlphaBlending();
+
+	entry.horizontal.begin();
+	shader.begin();
+	shader.setUniform1i("pass", 0);
+	shader.setUniform2f("texelSize", 1.0f / width, 1.0f / height);
+	shader.setUniform1f("blurRadius", settings.blurRadius);
+	shader.setUniform1f("sharpenRadius", settings.sharpenRadius);
+	source.draw(0, 0, width, height);
+	shader.end();
+	entry.horizontal.end();
+
+	entry.result.begin();
+	shader.begin();
+	shader.setUniform1i("pass", 1);
+	shader.setUniform2f("texelSize", 1.0f / width, 1.0f / height);
+	shader.setUniform1f("blurAmount", settings.blurAmount);
+	shader.setUniform1f("blurRadius", settings.blurRadius);
+	shader.setUniform1f("sharpenAmount", settings.sharpenAmount);
+	shader.setUniform1f("sharpenRadius", settings.sharpenRadius);
+	shader.setUniform1f("sharpenBoost", settings.sharpenBoost);
+	shader.setUniformTexture("source", source, SOURCE_UNIT);
+	entry.horizontal.draw(0, 0, width, height);
+	shader.end();
+	entry.result.end();
+
+	ofPopStyle();
+
+	// Everything else samples the source without mips
+	if (useMips) {
+		glBindTexture(data.textureTarget, data.textureID);
+		glTexParameteri(data.textureTarget, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glBindTexture(data.textureTarget, 0);
+	}
+}
+
+//--------------------------------------------------------------
+void FilterPrepass::renderCompute(const ofTexture& source, Entry& entry) {
+	const Settings& settings = entry.settings;
+	int width = (int)source.getWidth();
+	int height = (int)source.getHeight();
+	const ofTextureData& result = entry.result.getTexture().getTextureData();
+
+	computeShader.begin();
+	computeShader.setUniformTexture("source", source, 0);
+	computeShader.setUniform1f("blurAmount", settings.blurAmount);
+	computeShader.setUniform1f("blurRadius", settings.blurRadius);
+	computeShader.setUniform1f("sharpenAmount", settings.sharpenAmount);
+	computeShader.setUniform1f("sharpenRadius", settings.sharpenRadius);
+	computeShader.setUniform1f("sharpenBoost", settings.sharpenBoost);
+	glBindImageTexture(0, result.textureID, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA8);
+	computeShader.dispatchCompute((width + TILE - 1) / TILE, (height + TILE - 1) / TILE, 1);
+	glBindImageTexture(0, 0, 0, GL_FALSE, 0, GL_WRITE_ONLY, GL_RGBA8);
+	computeShader.end();
+
+	// The block shaders sample what the dispatch stored
+	glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "ofMain.h"
+#include <deque>
+
+// Blur and sharpen as their own passes, ahead of the block shaders. Each
+// source is filtered once per frame by shadersGL4/filter.frag, two
+// separable passes reading the source's mip chain, so the block shaders
+// sample the result with one fetch whatever the radius. Asking twice in a
+// frame for the same source and settings returns the first result.
+//
+// filter.comp does the same work with a compute shader instead, from
+// 16x16 tiles held in shared memory. Which path runs is chosen at runtime;
+// the fragment path stays the fallback if the compute shader is missing.
+class FilterPrepass {
+public:
+	struct Settings {
+		float blurAmount = 0;
+		float blurRadius = 1;       // texels
+		float sharpenAmount = 0;
+		float sharpenRadius = 1;    // texels
+		float sharpenBoost = 0;
+
+		bool operator==(const Settings& other) const {
+			return blurAmount == other.blurAmount && blurRadius == other.blurRadius
+				&& sharpenAmount == other.sharpenAmount && sharpenRadius == other.sharpenRadius
+				&& sharpenBoost == other.sharpenBoost;
+		}
+	};
+
+	bool setup(const std::string& shaderDir);
+	void setUseCompute(bool use);    // ignored when filter.comp did not load
+	bool isUsingCompute() const { return useCompute; }
+	// Earlier results are stale once the sources have been drawn to again
+	void beginFrame();
+	// The filtered source, or source itself when the settings leave it unchanged.
+	// Call outside any fbo begin / end; the result is valid until beginFrame().
+	const ofTexture& apply(const ofTexture& source, const Settings& settings);
+
+private:
+	static const int TILE = 16;                 // local size of filter.comp
+	static const int SOURCE_UNIT = 12;          // past the units the block shaders bind
+
+	struct Entry {
+		GLuint sourceId = 0;
+		Settings settings;
+		ofFbo horizontal;           // pass 0, rgb blur and sharpen brightness in alpha
+		ofFbo result;
+	};
+
+	void renderFragment(const ofTexture& source, Entry& entry);
+	void renderCompute(const ofTexture& source, Entry& entry);
+
+	ofShader shader;
+	ofShader computeShader;
+	bool loaded = false;
+	bool computeLoaded = false;
+	bool useCompute = false;
+	std::deque<Entry> entries;      // reused frame to frame in order of use; a deque so results stay put as it grows
+	size_t used = 0;
+};
@@ -0,0 +1,124 @@
+#include "GeneratorBatch.h"
+
+//--------------------------------------------------------------
+bool GeneratorBatch::setup(const std::string& shaderPath) {
+	for (int i = 0; i < ELLIPSE_SEGMENTS; i++) {
+		float theta = TWO_PI * i / ELLIPSE_SEGMENTS;
+		ellipse[i] = glm::vec2(cos(theta), sin(theta)) * 0.5f;
+	}
+
+	if (!shader.load(shaderPath)) {
+		ofLogError("Shader") << "Generator shader failed to load, line and ellipse generators are disabled";
+		return false;
+	}
+
+	// Immutable storage, mapped once for the life of the app
+	GLsizeiptr size = (GLsizeiptr)REGIONS * REGION_VERTICES * sizeof(Vertex);
+	GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+	glGenVertexArrays(1, &vao);
+	glGenBuffers(1, &vbo);
+	glBindVertexArray(vao);
+	glBindBuffer(GL_ARRAY_BUFFER, vbo);
+	glBufferStorage(GL_ARRAY_BUFFER, size, nullptr, flags);
+	mapped = (Vertex*)glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+
+	glEnableVertexAttribArray(ofShader::POSITION_ATTRIBUTE);
+	glVertexAttribPointer(ofShader::POSITION_ATTRIBUTE, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
+	glEnableVertexAttribArray(ofShader::COLOR_ATTRIBUTE);
+	glVertexAttribPointer(ofShader::COLOR_ATTRIBUTE, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (void*)offsetof(Vertex, color));
+	glBindVertexArray(0);
+	glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+	if (!mapped) ofLogError("Generators") << "Could not map the generator vertex buffer";
+	return mapped != nullptr;
+}
+
+//--------------------------------------------------------------
+void GeneratorBatch::begin() {
+	count = 0;
+	if (!mapped) return;
+
+	region = (region + 1) % REGIONS;
+	if (fences[region]) {
+		// Normally signalled long ago; only a GPU several frames behind waits here
+		glClientWaitSync(fences[region], GL_SYNC_FLUSH_COMMANDS_BIT, 100000000);
+		glDeleteSync(fences[region]);
+		fences[region] = nullptr;
+	}
+
+	glm::mat4 projection = ofGetCurrentMatrix(OF_MATRIX_PROJECTION);
+	pixelScale = fabs(projection[1][1]) * ofGetCurrentViewport().height * 0.5f;
+}
+
+//--------------------------------------------------------------
+void GeneratorBatch::setColor(const ofColor& c) {
+	color = (uint32_t)c.r | ((uint32_t)c.g << 8) | ((uint32_t)c.b << 16) | ((uint32_t)c.a << 24);
+}
+
+//--------------------------------------------------------------
+float GeneratorBatch::pixelSize(float z) const {
+	return pixelScale > 0 ? fabs(z) / pixelScale : 1.0f;
+}
+
+//--------------------------------------------------------------
+void GeneratorBatch::addTriangle(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c) {
+	if (!mapped) return;
+	if (count + 3 > REGION_VERTICES) {
+		if (!overflowed) ofLogWarning("Generators") << "Generator batch is full, dropping primitives";
+		overflowed = true;
+		return;
+	}
+	Vertex* out = mapped + region * REGION_VERTICES + count;
+	out[0] = { a, color };
+	out[1] = { b, color };
+	out[2] = { c, color };
+	count += 3;
+}
+
+//--------------------------------------------------------------
+void GeneratorBatch::addLine(const glm::vec3& from, const glm::vec3& to) {
+	glm::mat4 modelView = ofGetCurrentMatrix(OF_MATRIX_MODELVIEW);
+	glm::vec3 a = glm::vec3(modelView * glm::vec4(from, 1.0f));
+	glm::vec3 b = glm::vec3(modelView * glm::vec4(to, 1.0f));
+
+	// Widen across the line and the view direction
+	glm::vec3 side = glm::cross(b - a, (a + b) * 0.5f);
+	float length = glm::length(side);
+	if (length <= 0) return;
+	side /= length;
+	glm::vec3 sideA = side * (0.5f * pixelSize(a.z));
+	glm::vec3 sideB = side * (0.5f * pixelSize(b.z));
+
+	addTriangle(a - sideA, a + sideA, b + sideB);
+	addTriangle(a - sideA, b + sideB, b - sideB);
+}
+
+//--------------------------------------------------------------
+void GeneratorBatch::addEllipse(float x, float y, float width, float height) {
+	glm::mat4 modelView = ofGetCurrentMatrix(OF_MATRIX_MODELVIEW);
+	glm::vec3 center = glm::vec3(modelView * glm::vec4(x, y, 0.0f, 1.0f));
+	glm::vec3 axisX = glm::vec3(modelView * glm::vec4(width, 0.0f, 0.0f, 0.0f));
+	glm::vec3 axisY = glm::vec3(modelView * glm::vec4(0.0f, height, 0.0f, 0.0f));
+
+	glm::vec3 previous = center + axisX * ellipse[ELLIPSE_SEGMENTS - 1].x + axisY * ellipse[ELLIPSE_SEGMENTS - 1].y;
+	for (int i = 0; i < ELLIPSE_SEGMENTS; i++) {
+		glm::vec3 next = center + axisX * ellipse[i].x + axisY * ellipse[i].y;
+		addTriangle(center, previous, next);
+		previous = next;
+	}
+}
+
+//--------------------------------------------------------------
+void GeneratorBatch::draw() {
+	if (!mapped || count == 0) return;
+
+	// Positions are already in eye space; the shader only projects
+	shader.begin();
+	glBindVertexArray(vao);
+	glDrawArrays(GL_TRIANGLES, region * REGION_VERTICES, count);
+	glBindVertexArray(0);
+	shader.end();
+
+	fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	count = 0;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "ofMain.h"
+
+// Collects the lines and ellipses of the simple generators (line,
+// hypercube, seven star, spiral) into triangles and draws a block's worth
+// in one call. Vertices are written straight into a persistently mapped
+// VBO, split into a ring of regions. Each region is fenced when drawn and
+// only reused once the GPU is done with it.
+//
+// Primitives are transformed by the current openFrameworks model view
+// matrix when they are added, so ofPushMatrix / ofTranslate / ofRotate
+// keep working around them. Lines become quads one pixel wide, facing the
+// camera. The buffer lives as long as the output window's GL context, so
+// it is never unmapped.
+class GeneratorBatch {
+public:
+	bool setup(const std::string& shaderPath);
+
+	// Starts a batch in the next free region
+	void begin();
+	void setColor(const ofColor& color);
+	void addLine(const glm::vec3& from, const glm::vec3& to);
+	void addEllipse(float x, float y, float width, float height);
+	// One draw of everything added since begin()
+	void draw();
+
+private:
+	struct Vertex {
+		glm::vec3 position;     // eye space
+		uint32_t color;         // RGBA8
+	};
+
+	static const int REGIONS = 4;                   // two blocks a frame, in flight for up to two frames
+	static const int REGION_VERTICES = 1 << 15;
+	static const int ELLIPSE_SEGMENTS = 32;
+
+	void addTriangle(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c);
+	// Eye space width of one pixel at depth z
+	float pixelSize(float z) const;
+
+	ofShader shader;
+	GLuint vao = 0;
+	GLuint vbo = 0;
+	Vertex* mapped = nullptr;
+	GLsync fences[REGIONS] = {};
+	int region = 0;
+	int count = 0;
+	bool overflowed = false;
+
+	uint32_t color = 0xffffffff;
+	float pixelScale = 1.0f;    // projection[1][1] * viewport height / 2
+	glm::vec2 ellipse[ELLIPSE_SEGMENTS];
+};
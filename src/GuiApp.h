@@ -20,6 +20,14 @@ class ofApp;
 #include "ofMain.h"
 #include "ofxMidi.h"
 #include "ofxImGui.h"
+#include "MidiEventRing.h"
+#include "MidiRouter.h"
+#include "ParameterSchema.h"
+#include "ParameterMorph.h"
+#include "PresetLoader.h"
+#include "PresetSaver.h"
+#include "PresetIndex.h"
+#include "PresetThumbnailer.h"
 #include <map>
 #include <atomic>
 
@@ -29,60 +37,6 @@ class ofApp;
 #define OFAPP_HAS_SPOUT 0
 #endif
 
-#define PARAMETER_ARRAY_LENGTH 16
-
-// OSC Parameter types
-enum class OscParamType {
-    FLOAT,
-    BOOL,
-    INT
-};
-
-// Struct to bind a parameter to its OSC address
-struct OscParameter {
-    std::string address;
-    OscParamType type;
-    union {
-        float* floatPtr;
-        bool* boolPtr;
-        int* intPtr;
-    };
-
-    // Constructors for each type
-    OscParameter(const std::string& addr, float* ptr)
-        : address(addr), type(OscParamType::FLOAT), floatPtr(ptr) {}
-    OscParameter(const std::string& addr, bool* ptr)
-        : address(addr), type(OscParamType::BOOL), boolPtr(ptr) {}
-    OscParameter(const std::string& addr, int* ptr)
-        : address(addr), type(OscParamType::INT), intPtr(ptr) {}
-    OscParameter() : address(""), type(OscParamType::FLOAT), floatPtr(nullptr) {}
-
-    // Get value as float (for sending)
-    float getValueAsFloat() const {
-        switch(type) {
-            case OscParamType::FLOAT: return floatPtr ? *floatPtr : 0.0f;
-            case OscParamType::BOOL: return boolPtr ? (*boolPtr ? 1.0f : 0.0f) : 0.0f;
-            case OscParamType::INT: return intPtr ? static_cast<float>(*intPtr) : 0.0f;
-        }
-        return 0.0f;
-    }
-
-    // Set value from float (for receiving)
-    void setValueFromFloat(float value) {
-        switch(type) {
-            case OscParamType::FLOAT:
-                if(floatPtr) *floatPtr = value;
-                break;
-            case OscParamType::BOOL:
-                if(boolPtr) *boolPtr = (value > 0.5f);
-                break;
-            case OscParamType::INT:
-                if(intPtr) *intPtr = static_cast<int>(value);
-                break;
-        }
-    }
-};
-
 // OSC-enabled ImGui wrapper macro
 #define ImGuiSliderFloatOSC(label, var, min, max, address) \
 	if (ImGui::SliderFloat(label, var, min, max)) { \
@@ -113,8 +67,12 @@ public:
 	void connectMidiPort(int portIndex);
 	void newMidiMessage(ofxMidiMessage& eventArgs);
 	ofxMidiIn* midiIn;
-	std::vector<ofxMidiMessage> midiMessages;
-	std::size_t maxMessages = 10;
+	// Filled by the RtMidi callback, drained once per frame by midibiz()
+	MidiEventRing<512> midiEvents;
+	// Learnable [channel][cc] / NRPN routes straight to parameter handles
+	MidiRouter midiRouter;
+	char midiLearnFilter[128] = "";
+	int midiLearnSelection = -1;
 	std::vector<std::string> midiDeviceNames;
 	int selectedMidiPort = -1;
 	bool midiConnected = false;
@@ -123,6 +81,7 @@ public:
 	//save states
 	bool saveALL=0;
 	bool loadALL=0;
+	bool morphALL=0;
 
 	bool saveBLOCK1=0;
 	bool loadBLOCK1=0;
@@ -161,6 +120,16 @@ public:
 	int uiScaleIndex = 0;  // Default "200%" (2.0x actual scale)
 	float uiScaleValues[3] = {2.0f, 2.5f, 3.0f};
 
+	// Banks and presets on disk, kept current in the background
+	PresetIndex presetIndex;
+	PresetIndex::Banks presetBanks;     // copy the lists below are built from
+	uint64_t presetIndexVersion = 0;
+	std::string loadedBankPath;         // bank presetLoader is caching
+	void applyPresetIndex();
+	std::string presetBankName(const std::string& bankPath) const;
+	void buildPresetList(const std::string& bankPath, std::vector<std::string>& fileNames,
+		std::vector<std::string>& displayNames, std::vector<const char*>& displayNamesChar, int& count, int& selection);
+
 	// Preset bank functions
 	void scanBanks();
 	void switchSaveBank(int bankIndex);
@@ -168,6 +137,8 @@ public:
 	void indexSavePresets();
 	void indexLoadPresets();
 	void savePresetAs(const std::string& name);
+	void updateLoadBankCache();
+	void addPresetToIndex(const std::string& path);
 	bool renamePreset(int presetIndex, const std::string& newName);
 	std::string cleanDisplayName(const std::string& filename);
 	void migrateOldSaveStates();
@@ -177,15 +148,63 @@ public:
 
 	void saveBLOCK_1();
 
+	// Captures a snapshot and queues it on presetSaver
 	void saveEverything();
+	// Builds the JSON and binary files for a snapshot; const, runs on the saver thread
+	bool writePresetFile(const std::string& path, const PresetSnapshot& snapshot) const;
+	void presetSaved(const PresetSaver::Result& result);
+	PresetSaver presetSaver;
 
 	void loadBLOCK_1();
 
+	// Applies the selected load preset from presetLoader's cache, or queues it
+	// and applies it in a later update()
 	void loadEverything();
+	// Parses a preset file into a snapshot. Reads only the parameter schema
+	// and macro tables, which are fixed after setup, so the loader thread may call it
+	bool readPresetFile(const std::string& path, PresetSnapshot& snapshot) const;
+	bool readPresetJson(const std::string& path, PresetSnapshot& snapshot) const;
+	bool readPresetBinary(const std::string& path, PresetSnapshot& snapshot) const;
+	// Defaults for every field and no macros, what a preset fills in
+	void clearPresetSnapshot(PresetSnapshot& snapshot) const;
+	// One preset value by ParameterSchema::fieldId, from either file format
+	void readPresetValue(PresetSnapshot& snapshot, uint32_t id, float value) const;
+	bool writePresetBinary(const std::string& path, const PresetSnapshot& snapshot) const;
+	void capturePresetSnapshot(PresetSnapshot& snapshot) const;
+	void applyPresetSnapshot(const PresetSnapshot& snapshot);
+	// Writes a .gwpb next to every JSON preset in the bank, returns how many
+	int convertBankToBinary(const std::string& bankPath);
+	PresetLoader presetLoader;
+	PresetSnapshot recallSnapshot;   // reused so recalling does not allocate
+
+	// Like loadEverything(), but the parameters glide to the preset over morphTimeMs
+	void morphEverything();
+	void startPresetMorph(const PresetSnapshot& snapshot);
+	void morphUpdate();
+	ParameterMorph parameterMorph;
+	PresetSnapshot morphSnapshot;    // target of the running morph; its macros go in at the switch point
+	bool morphRequested = false;     // the snapshot presetLoader delivers next starts a morph
+	float morphTimeMs = 2000.0f;
+	int morphCurve = ParameterMorph::CURVE_SMOOTH;
+	float morphSwitchPoint = 0.5f;
+
+	// Preset thumbnails: mainApp captures them from the output, presetThumbnailer
+	// writes and reads the PNGs, and the decoded pixels are uploaded here
+	struct PresetThumbnail {
+		ofTexture texture;
+		bool requested = false;
+	};
+	PresetThumbnailer presetThumbnailer;
+	std::map<std::string, PresetThumbnail> presetThumbnails;    // by .png path
+	int presetThumbnailSettleFrames = 60;     // output frames before a recalled preset is captured
+	void presetThumbnailsUpdate();
+	// Thumbnail texture of a preset, nullptr until it is decoded or if there is none
+	const ofTexture* getPresetThumbnail(const std::string& presetPath);
+	void forgetPresetThumbnail(const std::string& presetPath);
 
 	void arrayToJsonList(ofJson jsonFile, string blockName, string listName, float inArray[]);
 	void arrayToJsonList(string listName, float inArray[]);//assume: theres a global existing json file we refer to.
-	void jsonListToArray(ofJson jsonFile, string listName, float outArray[]);
+	void jsonListToArray(const ofJson& jsonFile, const string& listName, float outArray[]);
 	//both of these above functions assume a globally defined constant or #defined arraylength
 	// and neighter of them are being used as of 2-14-24 lol
 
@@ -216,6 +235,7 @@ public:
 	bool oscConnected = false;
 	bool sendAllOscValues = false;  // Trigger for sending all OSC values
 	bool oscSettingsReloadRequested = false;  // Trigger for reloading OSC settings
+	float oscBundleLatencyMs = 0;  // Added to bundle timetags before scheduling
 	void updateLocalIP();
 	std::vector<std::string> localIPs;  // All available network IPs
 
@@ -266,6 +286,10 @@ public:
 	// Performance Settings
 	int targetFPS = 30;  // Target frame rate (1-60)
 	bool fpsChangeRequested = false;  // Flag to apply FPS change in main app
+	int filterPath = 0;  // Blur / sharpen pre-pass: 0 fragment, 1 compute tiles
+	bool resolutionGovernor = false;  // Lower the block 1/2 render area when over the frame budget
+	int upscaleMode = 1;  // Upscaler::Mode for blocks 1/2 into Block 3
+	float upscaleSharpness = 0.5f;  // 0-1, lanczos + sharpen only
 
 	// Resolution Settings
 	// Input resolutions (for webcam/NDI/Spout capture scaling)
@@ -352,70 +376,39 @@ public:
 	const int finalMixAndKeyLfoLength=6;
 
 
-	//NEW macroMapping procedures
-
-	//BLOCK1
-	void macroBLOCK_1Ch1Adjust(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_1Ch2MixAndKey(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_1Ch2Adjust(int parameterIndex, int macroDataIndex);
-
-	void macroBLOCK_1Ch1AdjustLfo(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_1Ch2MixAndKeyLfo(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_1Ch2AdjustLfo(int parameterIndex, int macroDataIndex);
-
-	void macroBLOCK_1Fb1MixAndKey(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_1Fb1Geo1(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_1Fb1Color1(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_1Fb1Filters(int parameterIndex, int macroDataIndex);
-
-	void macroBLOCK_1Fb1MixAndKeyLfo(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_1Fb1Geo1Lfo1(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_1Fb1Geo1Lfo2(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_1Fb1Color1Lfo1(int parameterIndex, int macroDataIndex);
-
-	//BLOCK2
-	void macroBLOCK_2Block2InputAdjust(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_2Block2InputAdjustLfo(int parameterIndex, int macroDataIndex);
-
-	void macroBLOCK_2Fb2MixAndKey(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_2Fb2Geo1(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_2Fb2Color1(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_2Fb2Filters(int parameterIndex, int macroDataIndex);
-
-	void macroBLOCK_2Fb2MixAndKeyLfo(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_2Fb2Geo1Lfo1(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_2Fb2Geo1Lfo2(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_2Fb2Color1Lfo1(int parameterIndex, int macroDataIndex);
-
-	//BLOCK3
-	void macroBLOCK_3Block1Geo(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_3Block1Colorize(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_3Block1Filters(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_3Block1Geo1Lfo1(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_3Block1Geo1Lfo2(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_3Block1ColorizeLfo1(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_3Block1ColorizeLfo2(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_3Block1ColorizeLfo3(int parameterIndex, int macroDataIndex);
-
-	void macroBLOCK_3Block2Geo(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_3Block2Colorize(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_3Block2Filters(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_3Block2Geo1Lfo1(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_3Block2Geo1Lfo2(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_3Block2ColorizeLfo1(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_3Block2ColorizeLfo2(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_3Block2ColorizeLfo3(int parameterIndex, int macroDataIndex);
-
-	void macroBLOCK_3MatrixMix(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_3FinalMixAndKey(int parameterIndex, int macroDataIndex);
-
-	void macroBLOCK_3MatrixMixLfo1(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_3MatrixMixLfo2(int parameterIndex, int macroDataIndex);
-	void macroBLOCK_3FinalMixAndKeyLfo(int parameterIndex, int macroDataIndex);
-
-
-	void macroBLOCK_1Fb1DelayTime(int macroDataIndex);
-	void macroBLOCK_1Fb2DelayTime(int macroDataIndex);
+	//macro routing
+	//every macro slider drives at most one parameter. assignments are stored as
+	//(group, parameter) pairs and flattened into macroRoutes only when one changes,
+	//so the per frame cost is one pass over the active routes
+	struct MacroGroup {
+		const char* menu;      //top level menu, b1 b2 b3
+		const char* subMenu;   //second level menu
+		const char* label;
+		const char* block;     //save file block, BLOCK_1 ...
+		const char* key;       //saved as selectMacro<N><key>
+		float* params;
+		string* names;
+		int length;            //0 for single value targets like the delay times
+		float scale;
+		float offset;
+	};
+	struct MacroRoute {
+		float* target;
+		int macroDataIndex;
+		float scale;
+		float offset;
+	};
+	std::vector<MacroGroup> macroGroups;
+	std::unordered_map<uint32_t, std::pair<int,int>> presetMacroIds;   //macro, group (-1 for macroData)
+	std::vector<MacroRoute> macroRoutes;
+	int macroAssignGroup[PARAMETER_ARRAY_LENGTH];   //-1 for none
+	int macroAssignParam[PARAMETER_ARRAY_LENGTH];
+	bool macroRoutesDirty=true;
+
+	void initializeMacroGroups();
+	void assignMacro(int macroDataIndex, int groupIndex, int parameterIndex);
+	void rebuildMacroRoutes();
+	void selectMacroMenu(int macroDataIndex);
 
 	//BLOCK1
 	void initializeNames();
@@ -483,923 +476,6 @@ public:
 	string finalMixAndKeyLfoNames[PARAMETER_ARRAY_LENGTH];
 
 
-	//macro0
-	int selectMacro0Ch1Adjust=0;
-	int selectMacro0Ch2MixAndKey=0;
-	int selectMacro0Ch2Adjust=0;
-	int selectMacro0Ch1AdjustLfo=0;
-	int selectMacro0Ch2MixAndKeyLfo=0;
-	int selectMacro0Ch2AdjustLfo=0;
-	int selectMacro0Fb1MixAndKey=0;
-	int selectMacro0Fb1Geo1=0;
-	int selectMacro0Fb1Color1=0;
-	int selectMacro0Fb1Filters=0;
-	int selectMacro0Fb1MixAndKeyLfo=0;
-	int selectMacro0Fb1Geo1Lfo1=0;
-	int selectMacro0Fb1Geo1Lfo2=0;
-	int selectMacro0Fb1Color1Lfo1=0;
-
-	int selectMacro0Fb1DelayTime=0;
-	//b2
-	int selectMacro0Block2InputAdjust=0;
-	int selectMacro0Block2InputAdjustLfo=0;
-	int selectMacro0Fb2MixAndKey=0;
-	int selectMacro0Fb2Geo1=0;
-	int selectMacro0Fb2Color1=0;
-	int selectMacro0Fb2Filters=0;
-	int selectMacro0Fb2MixAndKeyLfo=0;
-	int selectMacro0Fb2Geo1Lfo1=0;
-	int selectMacro0Fb2Geo1Lfo2=0;
-	int selectMacro0Fb2Color1Lfo1=0;
-
-	int selectMacro0Fb2DelayTime=0;
-	//b3
-	int selectMacro0Block1Geo=0;
-	int selectMacro0Block1Colorize=0;
-	int selectMacro0Block1Filters=0;
-	int selectMacro0Block1Geo1Lfo1=0;
-	int selectMacro0Block1Geo1Lfo2=0;
-	int selectMacro0Block1ColorizeLfo1=0;
-	int selectMacro0Block1ColorizeLfo2=0;
-	int selectMacro0Block1ColorizeLfo3=0;
-	int selectMacro0Block2Geo=0;
-	int selectMacro0Block2Colorize=0;
-	int selectMacro0Block2Filters=0;
-	int selectMacro0Block2Geo1Lfo1=0;
-	int selectMacro0Block2Geo1Lfo2=0;
-	int selectMacro0Block2ColorizeLfo1=0;
-	int selectMacro0Block2ColorizeLfo2=0;
-	int selectMacro0Block2ColorizeLfo3=0;
-	int selectMacro0MatrixMix=0;
-	int selectMacro0FinalMixAndKey=0;
-	int selectMacro0MatrixMixLfo1=0;
-	int selectMacro0MatrixMixLfo2=0;
-	int selectMacro0FinalMixAndKeyLfo=0;
-
-	//menu procedures
-	void selectMacro0Menu();
-	void ifSelectMacro0();
-
-
-
-
-
-	//macro1
-	int selectMacro1Ch1Adjust=0;
-	int selectMacro1Ch2MixAndKey=0;
-	int selectMacro1Ch2Adjust=0;
-	int selectMacro1Ch1AdjustLfo=0;
-	int selectMacro1Ch2MixAndKeyLfo=0;
-	int selectMacro1Ch2AdjustLfo=0;
-	int selectMacro1Fb1MixAndKey=0;
-	int selectMacro1Fb1Geo1=0;
-	int selectMacro1Fb1Color1=0;
-	int selectMacro1Fb1Filters=0;
-	int selectMacro1Fb1MixAndKeyLfo=0;
-	int selectMacro1Fb1Geo1Lfo1=0;
-	int selectMacro1Fb1Geo1Lfo2=0;
-	int selectMacro1Fb1Color1Lfo1=0;
-
-	int selectMacro1Fb1DelayTime=0;
-	//b2
-	int selectMacro1Block2InputAdjust=0;
-	int selectMacro1Block2InputAdjustLfo=0;
-	int selectMacro1Fb2MixAndKey=0;
-	int selectMacro1Fb2Geo1=0;
-	int selectMacro1Fb2Color1=0;
-	int selectMacro1Fb2Filters=0;
-	int selectMacro1Fb2MixAndKeyLfo=0;
-	int selectMacro1Fb2Geo1Lfo1=0;
-	int selectMacro1Fb2Geo1Lfo2=0;
-	int selectMacro1Fb2Color1Lfo1=0;
-
-	int selectMacro1Fb2DelayTime=0;
-	//b3
-	int selectMacro1Block1Geo=0;
-	int selectMacro1Block1Colorize=0;
-	int selectMacro1Block1Filters=0;
-	int selectMacro1Block1Geo1Lfo1=0;
-	int selectMacro1Block1Geo1Lfo2=0;
-	int selectMacro1Block1ColorizeLfo1=0;
-	int selectMacro1Block1ColorizeLfo2=0;
-	int selectMacro1Block1ColorizeLfo3=0;
-	int selectMacro1Block2Geo=0;
-	int selectMacro1Block2Colorize=0;
-	int selectMacro1Block2Filters=0;
-	int selectMacro1Block2Geo1Lfo1=0;
-	int selectMacro1Block2Geo1Lfo2=0;
-	int selectMacro1Block2ColorizeLfo1=0;
-	int selectMacro1Block2ColorizeLfo2=0;
-	int selectMacro1Block2ColorizeLfo3=0;
-	int selectMacro1MatrixMix=0;
-	int selectMacro1FinalMixAndKey=0;
-	int selectMacro1MatrixMixLfo1=0;
-	int selectMacro1MatrixMixLfo2=0;
-	int selectMacro1FinalMixAndKeyLfo=0;
-
-	//menu procedures
-	void selectMacro1Menu();
-	void ifSelectMacro1();
-
-
-	//macro2
-	int selectMacro2Ch1Adjust=0;
-	int selectMacro2Ch2MixAndKey=0;
-	int selectMacro2Ch2Adjust=0;
-	int selectMacro2Ch1AdjustLfo=0;
-	int selectMacro2Ch2MixAndKeyLfo=0;
-	int selectMacro2Ch2AdjustLfo=0;
-	int selectMacro2Fb1MixAndKey=0;
-	int selectMacro2Fb1Geo1=0;
-	int selectMacro2Fb1Color1=0;
-	int selectMacro2Fb1Filters=0;
-	int selectMacro2Fb1MixAndKeyLfo=0;
-	int selectMacro2Fb1Geo1Lfo1=0;
-	int selectMacro2Fb1Geo1Lfo2=0;
-	int selectMacro2Fb1Color1Lfo1=0;
-
-	int selectMacro2Fb1DelayTime=0;
-	//b2
-	int selectMacro2Block2InputAdjust=0;
-	int selectMacro2Block2InputAdjustLfo=0;
-	int selectMacro2Fb2MixAndKey=0;
-	int selectMacro2Fb2Geo1=0;
-	int selectMacro2Fb2Color1=0;
-	int selectMacro2Fb2Filters=0;
-	int selectMacro2Fb2MixAndKeyLfo=0;
-	int selectMacro2Fb2Geo1Lfo1=0;
-	int selectMacro2Fb2Geo1Lfo2=0;
-	int selectMacro2Fb2Color1Lfo1=0;
-
-	int selectMacro2Fb2DelayTime=0;
-	//b3
-	int selectMacro2Block1Geo=0;
-	int selectMacro2Block1Colorize=0;
-	int selectMacro2Block1Filters=0;
-	int selectMacro2Block1Geo1Lfo1=0;
-	int selectMacro2Block1Geo1Lfo2=0;
-	int selectMacro2Block1ColorizeLfo1=0;
-	int selectMacro2Block1ColorizeLfo2=0;
-	int selectMacro2Block1ColorizeLfo3=0;
-	int selectMacro2Block2Geo=0;
-	int selectMacro2Block2Colorize=0;
-	int selectMacro2Block2Filters=0;
-	int selectMacro2Block2Geo1Lfo1=0;
-	int selectMacro2Block2Geo1Lfo2=0;
-	int selectMacro2Block2ColorizeLfo1=0;
-	int selectMacro2Block2ColorizeLfo2=0;
-	int selectMacro2Block2ColorizeLfo3=0;
-	int selectMacro2MatrixMix=0;
-	int selectMacro2FinalMixAndKey=0;
-	int selectMacro2MatrixMixLfo1=0;
-	int selectMacro2MatrixMixLfo2=0;
-	int selectMacro2FinalMixAndKeyLfo=0;
-
-	//menu procedures
-	void selectMacro2Menu();
-	void ifSelectMacro2();
-
-	//macro3
-	int selectMacro3Ch1Adjust=0;
-	int selectMacro3Ch2MixAndKey=0;
-	int selectMacro3Ch2Adjust=0;
-	int selectMacro3Ch1AdjustLfo=0;
-	int selectMacro3Ch2MixAndKeyLfo=0;
-	int selectMacro3Ch2AdjustLfo=0;
-	int selectMacro3Fb1MixAndKey=0;
-	int selectMacro3Fb1Geo1=0;
-	int selectMacro3Fb1Color1=0;
-	int selectMacro3Fb1Filters=0;
-	int selectMacro3Fb1MixAndKeyLfo=0;
-	int selectMacro3Fb1Geo1Lfo1=0;
-	int selectMacro3Fb1Geo1Lfo2=0;
-	int selectMacro3Fb1Color1Lfo1=0;
-
-	int selectMacro3Fb1DelayTime=0;
-	//b2
-	int selectMacro3Block2InputAdjust=0;
-	int selectMacro3Block2InputAdjustLfo=0;
-	int selectMacro3Fb2MixAndKey=0;
-	int selectMacro3Fb2Geo1=0;
-	int selectMacro3Fb2Color1=0;
-	int selectMacro3Fb2Filters=0;
-	int selectMacro3Fb2MixAndKeyLfo=0;
-	int selectMacro3Fb2Geo1Lfo1=0;
-	int selectMacro3Fb2Geo1Lfo2=0;
-	int selectMacro3Fb2Color1Lfo1=0;
-
-	int selectMacro3Fb2DelayTime=0;
-	//b3
-	int selectMacro3Block1Geo=0;
-	int selectMacro3Block1Colorize=0;
-	int selectMacro3Block1Filters=0;
-	int selectMacro3Block1Geo1Lfo1=0;
-	int selectMacro3Block1Geo1Lfo2=0;
-	int selectMacro3Block1ColorizeLfo1=0;
-	int selectMacro3Block1ColorizeLfo2=0;
-	int selectMacro3Block1ColorizeLfo3=0;
-	int selectMacro3Block2Geo=0;
-	int selectMacro3Block2Colorize=0;
-	int selectMacro3Block2Filters=0;
-	int selectMacro3Block2Geo1Lfo1=0;
-	int selectMacro3Block2Geo1Lfo2=0;
-	int selectMacro3Block2ColorizeLfo1=0;
-	int selectMacro3Block2ColorizeLfo2=0;
-	int selectMacro3Block2ColorizeLfo3=0;
-	int selectMacro3MatrixMix=0;
-	int selectMacro3FinalMixAndKey=0;
-	int selectMacro3MatrixMixLfo1=0;
-	int selectMacro3MatrixMixLfo2=0;
-	int selectMacro3FinalMixAndKeyLfo=0;
-
-	//menu procedures
-	void selectMacro3Menu();
-	void ifSelectMacro3();
-
-	//macro4
-	int selectMacro4Ch1Adjust=0;
-	int selectMacro4Ch2MixAndKey=0;
-	int selectMacro4Ch2Adjust=0;
-	int selectMacro4Ch1AdjustLfo=0;
-	int selectMacro4Ch2MixAndKeyLfo=0;
-	int selectMacro4Ch2AdjustLfo=0;
-	int selectMacro4Fb1MixAndKey=0;
-	int selectMacro4Fb1Geo1=0;
-	int selectMacro4Fb1Color1=0;
-	int selectMacro4Fb1Filters=0;
-	int selectMacro4Fb1MixAndKeyLfo=0;
-	int selectMacro4Fb1Geo1Lfo1=0;
-	int selectMacro4Fb1Geo1Lfo2=0;
-	int selectMacro4Fb1Color1Lfo1=0;
-
-	int selectMacro4Fb1DelayTime=0;
-	//b2
-	int selectMacro4Block2InputAdjust=0;
-	int selectMacro4Block2InputAdjustLfo=0;
-	int selectMacro4Fb2MixAndKey=0;
-	int selectMacro4Fb2Geo1=0;
-	int selectMacro4Fb2Color1=0;
-	int selectMacro4Fb2Filters=0;
-	int selectMacro4Fb2MixAndKeyLfo=0;
-	int selectMacro4Fb2Geo1Lfo1=0;
-	int selectMacro4Fb2Geo1Lfo2=0;
-	int selectMacro4Fb2Color1Lfo1=0;
-
-	int selectMacro4Fb2DelayTime=0;
-	//b3
-	int selectMacro4Block1Geo=0;
-	int selectMacro4Block1Colorize=0;
-	int selectMacro4Block1Filters=0;
-	int selectMacro4Block1Geo1Lfo1=0;
-	int selectMacro4Block1Geo1Lfo2=0;
-	int selectMacro4Block1ColorizeLfo1=0;
-	int selectMacro4Block1ColorizeLfo2=0;
-	int selectMacro4Block1ColorizeLfo3=0;
-	int selectMacro4Block2Geo=0;
-	int selectMacro4Block2Colorize=0;
-	int selectMacro4Block2Filters=0;
-	int selectMacro4Block2Geo1Lfo1=0;
-	int selectMacro4Block2Geo1Lfo2=0;
-	int selectMacro4Block2ColorizeLfo1=0;
-	int selectMacro4Block2ColorizeLfo2=0;
-	int selectMacro4Block2ColorizeLfo3=0;
-	int selectMacro4MatrixMix=0;
-	int selectMacro4FinalMixAndKey=0;
-	int selectMacro4MatrixMixLfo1=0;
-	int selectMacro4MatrixMixLfo2=0;
-	int selectMacro4FinalMixAndKeyLfo=0;
-
-	//menu procedures
-	void selectMacro4Menu();
-	void ifSelectMacro4();
-
-	//macro5
-	int selectMacro5Ch1Adjust=0;
-	int selectMacro5Ch2MixAndKey=0;
-	int selectMacro5Ch2Adjust=0;
-	int selectMacro5Ch1AdjustLfo=0;
-	int selectMacro5Ch2MixAndKeyLfo=0;
-	int selectMacro5Ch2AdjustLfo=0;
-	int selectMacro5Fb1MixAndKey=0;
-	int selectMacro5Fb1Geo1=0;
-	int selectMacro5Fb1Color1=0;
-	int selectMacro5Fb1Filters=0;
-	int selectMacro5Fb1MixAndKeyLfo=0;
-	int selectMacro5Fb1Geo1Lfo1=0;
-	int selectMacro5Fb1Geo1Lfo2=0;
-	int selectMacro5Fb1Color1Lfo1=0;
-
-	int selectMacro5Fb1DelayTime=0;
-	//b2
-	int selectMacro5Block2InputAdjust=0;
-	int selectMacro5Block2InputAdjustLfo=0;
-	int selectMacro5Fb2MixAndKey=0;
-	int selectMacro5Fb2Geo1=0;
-	int selectMacro5Fb2Color1=0;
-	int selectMacro5Fb2Filters=0;
-	int selectMacro5Fb2MixAndKeyLfo=0;
-	int selectMacro5Fb2Geo1Lfo1=0;
-	int selectMacro5Fb2Geo1Lfo2=0;
-	int selectMacro5Fb2Color1Lfo1=0;
-
-	int selectMacro5Fb2DelayTime=0;
-	//b3
-	int selectMacro5Block1Geo=0;
-	int selectMacro5Block1Colorize=0;
-	int selectMacro5Block1Filters=0;
-	int selectMacro5Block1Geo1Lfo1=0;
-	int selectMacro5Block1Geo1Lfo2=0;
-	int selectMacro5Block1ColorizeLfo1=0;
-	int selectMacro5Block1ColorizeLfo2=0;
-	int selectMacro5Block1ColorizeLfo3=0;
-	int selectMacro5Block2Geo=0;
-	int selectMacro5Block2Colorize=0;
-	int selectMacro5Block2Filters=0;
-	int selectMacro5Block2Geo1Lfo1=0;
-	int selectMacro5Block2Geo1Lfo2=0;
-	int selectMacro5Block2ColorizeLfo1=0;
-	int selectMacro5Block2ColorizeLfo2=0;
-	int selectMacro5Block2ColorizeLfo3=0;
-	int selectMacro5MatrixMix=0;
-	int selectMacro5FinalMixAndKey=0;
-	int selectMacro5MatrixMixLfo1=0;
-	int selectMacro5MatrixMixLfo2=0;
-	int selectMacro5FinalMixAndKeyLfo=0;
-
-	//menu procedures
-	void selectMacro5Menu();
-	void ifSelectMacro5();
-
-	//macro6
-	int selectMacro6Ch1Adjust=0;
-	int selectMacro6Ch2MixAndKey=0;
-	int selectMacro6Ch2Adjust=0;
-	int selectMacro6Ch1AdjustLfo=0;
-	int selectMacro6Ch2MixAndKeyLfo=0;
-	int selectMacro6Ch2AdjustLfo=0;
-	int selectMacro6Fb1MixAndKey=0;
-	int selectMacro6Fb1Geo1=0;
-	int selectMacro6Fb1Color1=0;
-	int selectMacro6Fb1Filters=0;
-	int selectMacro6Fb1MixAndKeyLfo=0;
-	int selectMacro6Fb1Geo1Lfo1=0;
-	int selectMacro6Fb1Geo1Lfo2=0;
-	int selectMacro6Fb1Color1Lfo1=0;
-
-	int selectMacro6Fb1DelayTime=0;
-	//b2
-	int selectMacro6Block2InputAdjust=0;
-	int selectMacro6Block2InputAdjustLfo=0;
-	int selectMacro6Fb2MixAndKey=0;
-	int selectMacro6Fb2Geo1=0;
-	int selectMacro6Fb2Color1=0;
-	int selectMacro6Fb2Filters=0;
-	int selectMacro6Fb2MixAndKeyLfo=0;
-	int selectMacro6Fb2Geo1Lfo1=0;
-	int selectMacro6Fb2Geo1Lfo2=0;
-	int selectMacro6Fb2Color1Lfo1=0;
-
-	int selectMacro6Fb2DelayTime=0;
-	//b3
-	int selectMacro6Block1Geo=0;
-	int selectMacro6Block1Colorize=0;
-	int selectMacro6Block1Filters=0;
-	int selectMacro6Block1Geo1Lfo1=0;
-	int selectMacro6Block1Geo1Lfo2=0;
-	int selectMacro6Block1ColorizeLfo1=0;
-	int selectMacro6Block1ColorizeLfo2=0;
-	int selectMacro6Block1ColorizeLfo3=0;
-	int selectMacro6Block2Geo=0;
-	int selectMacro6Block2Colorize=0;
-	int selectMacro6Block2Filters=0;
-	int selectMacro6Block2Geo1Lfo1=0;
-	int selectMacro6Block2Geo1Lfo2=0;
-	int selectMacro6Block2ColorizeLfo1=0;
-	int selectMacro6Block2ColorizeLfo2=0;
-	int selectMacro6Block2ColorizeLfo3=0;
-	int selectMacro6MatrixMix=0;
-	int selectMacro6FinalMixAndKey=0;
-	int selectMacro6MatrixMixLfo1=0;
-	int selectMacro6MatrixMixLfo2=0;
-	int selectMacro6FinalMixAndKeyLfo=0;
-
-	//menu procedures
-	void selectMacro6Menu();
-	void ifSelectMacro6();
-
-	//macro7
-	int selectMacro7Ch1Adjust=0;
-	int selectMacro7Ch2MixAndKey=0;
-	int selectMacro7Ch2Adjust=0;
-	int selectMacro7Ch1AdjustLfo=0;
-	int selectMacro7Ch2MixAndKeyLfo=0;
-	int selectMacro7Ch2AdjustLfo=0;
-	int selectMacro7Fb1MixAndKey=0;
-	int selectMacro7Fb1Geo1=0;
-	int selectMacro7Fb1Color1=0;
-	int selectMacro7Fb1Filters=0;
-	int selectMacro7Fb1MixAndKeyLfo=0;
-	int selectMacro7Fb1Geo1Lfo1=0;
-	int selectMacro7Fb1Geo1Lfo2=0;
-	int selectMacro7Fb1Color1Lfo1=0;
-
-	int selectMacro7Fb1DelayTime=0;
-	//b2
-	int selectMacro7Block2InputAdjust=0;
-	int selectMacro7Block2InputAdjustLfo=0;
-	int selectMacro7Fb2MixAndKey=0;
-	int selectMacro7Fb2Geo1=0;
-	int selectMacro7Fb2Color1=0;
-	int selectMacro7Fb2Filters=0;
-	int selectMacro7Fb2MixAndKeyLfo=0;
-	int selectMacro7Fb2Geo1Lfo1=0;
-	int selectMacro7Fb2Geo1Lfo2=0;
-	int selectMacro7Fb2Color1Lfo1=0;
-
-	int selectMacro7Fb2DelayTime=0;
-	//b3
-	int selectMacro7Block1Geo=0;
-	int selectMacro7Block1Colorize=0;
-	int selectMacro7Block1Filters=0;
-	int selectMacro7Block1Geo1Lfo1=0;
-	int selectMacro7Block1Geo1Lfo2=0;
-	int selectMacro7Block1ColorizeLfo1=0;
-	int selectMacro7Block1ColorizeLfo2=0;
-	int selectMacro7Block1ColorizeLfo3=0;
-	int selectMacro7Block2Geo=0;
-	int selectMacro7Block2Colorize=0;
-	int selectMacro7Block2Filters=0;
-	int selectMacro7Block2Geo1Lfo1=0;
-	int selectMacro7Block2Geo1Lfo2=0;
-	int selectMacro7Block2ColorizeLfo1=0;
-	int selectMacro7Block2ColorizeLfo2=0;
-	int selectMacro7Block2ColorizeLfo3=0;
-	int selectMacro7MatrixMix=0;
-	int selectMacro7FinalMixAndKey=0;
-	int selectMacro7MatrixMixLfo1=0;
-	int selectMacro7MatrixMixLfo2=0;
-	int selectMacro7FinalMixAndKeyLfo=0;
-
-	//menu procedures
-	void selectMacro7Menu();
-	void ifSelectMacro7();
-
-	//macro8
-	int selectMacro8Ch1Adjust=0;
-	int selectMacro8Ch2MixAndKey=0;
-	int selectMacro8Ch2Adjust=0;
-	int selectMacro8Ch1AdjustLfo=0;
-	int selectMacro8Ch2MixAndKeyLfo=0;
-	int selectMacro8Ch2AdjustLfo=0;
-	int selectMacro8Fb1MixAndKey=0;
-	int selectMacro8Fb1Geo1=0;
-	int selectMacro8Fb1Color1=0;
-	int selectMacro8Fb1Filters=0;
-	int selectMacro8Fb1MixAndKeyLfo=0;
-	int selectMacro8Fb1Geo1Lfo1=0;
-	int selectMacro8Fb1Geo1Lfo2=0;
-	int selectMacro8Fb1Color1Lfo1=0;
-
-	int selectMacro8Fb1DelayTime=0;
-	//b2
-	int selectMacro8Block2InputAdjust=0;
-	int selectMacro8Block2InputAdjustLfo=0;
-	int selectMacro8Fb2MixAndKey=0;
-	int selectMacro8Fb2Geo1=0;
-	int selectMacro8Fb2Color1=0;
-	int selectMacro8Fb2Filters=0;
-	int selectMacro8Fb2MixAndKeyLfo=0;
-	int selectMacro8Fb2Geo1Lfo1=0;
-	int selectMacro8Fb2Geo1Lfo2=0;
-	int selectMacro8Fb2Color1Lfo1=0;
-
-	int selectMacro8Fb2DelayTime=0;
-	//b3
-	int selectMacro8Block1Geo=0;
-	int selectMacro8Block1Colorize=0;
-	int selectMacro8Block1Filters=0;
-	int selectMacro8Block1Geo1Lfo1=0;
-	int selectMacro8Block1Geo1Lfo2=0;
-	int selectMacro8Block1ColorizeLfo1=0;
-	int selectMacro8Block1ColorizeLfo2=0;
-	int selectMacro8Block1ColorizeLfo3=0;
-	int selectMacro8Block2Geo=0;
-	int selectMacro8Block2Colorize=0;
-	int selectMacro8Block2Filters=0;
-	int selectMacro8Block2Geo1Lfo1=0;
-	int selectMacro8Block2Geo1Lfo2=0;
-	int selectMacro8Block2ColorizeLfo1=0;
-	int selectMacro8Block2ColorizeLfo2=0;
-	int selectMacro8Block2ColorizeLfo3=0;
-	int selectMacro8MatrixMix=0;
-	int selectMacro8FinalMixAndKey=0;
-	int selectMacro8MatrixMixLfo1=0;
-	int selectMacro8MatrixMixLfo2=0;
-	int selectMacro8FinalMixAndKeyLfo=0;
-
-	//menu procedures
-	void selectMacro8Menu();
-	void ifSelectMacro8();
-
-	//macro9
-	int selectMacro9Ch1Adjust=0;
-	int selectMacro9Ch2MixAndKey=0;
-	int selectMacro9Ch2Adjust=0;
-	int selectMacro9Ch1AdjustLfo=0;
-	int selectMacro9Ch2MixAndKeyLfo=0;
-	int selectMacro9Ch2AdjustLfo=0;
-	int selectMacro9Fb1MixAndKey=0;
-	int selectMacro9Fb1Geo1=0;
-	int selectMacro9Fb1Color1=0;
-	int selectMacro9Fb1Filters=0;
-	int selectMacro9Fb1MixAndKeyLfo=0;
-	int selectMacro9Fb1Geo1Lfo1=0;
-	int selectMacro9Fb1Geo1Lfo2=0;
-	int selectMacro9Fb1Color1Lfo1=0;
-
-	int selectMacro9Fb1DelayTime=0;
-	//b2
-	int selectMacro9Block2InputAdjust=0;
-	int selectMacro9Block2InputAdjustLfo=0;
-	int selectMacro9Fb2MixAndKey=0;
-	int selectMacro9Fb2Geo1=0;
-	int selectMacro9Fb2Color1=0;
-	int selectMacro9Fb2Filters=0;
-	int selectMacro9Fb2MixAndKeyLfo=0;
-	int selectMacro9Fb2Geo1Lfo1=0;
-	int selectMacro9Fb2Geo1Lfo2=0;
-	int selectMacro9Fb2Color1Lfo1=0;
-
-	int selectMacro9Fb2DelayTime=0;
-	//b3
-	int selectMacro9Block1Geo=0;
-	int selectMacro9Block1Colorize=0;
-	int selectMacro9Block1Filters=0;
-	int selectMacro9Block1Geo1Lfo1=0;
-	int selectMacro9Block1Geo1Lfo2=0;
-	int selectMacro9Block1ColorizeLfo1=0;
-	int selectMacro9Block1ColorizeLfo2=0;
-	int selectMacro9Block1ColorizeLfo3=0;
-	int selectMacro9Block2Geo=0;
-	int selectMacro9Block2Colorize=0;
-	int selectMacro9Block2Filters=0;
-	int selectMacro9Block2Geo1Lfo1=0;
-	int selectMacro9Block2Geo1Lfo2=0;
-	int selectMacro9Block2ColorizeLfo1=0;
-	int selectMacro9Block2ColorizeLfo2=0;
-	int selectMacro9Block2ColorizeLfo3=0;
-	int selectMacro9MatrixMix=0;
-	int selectMacro9FinalMixAndKey=0;
-	int selectMacro9MatrixMixLfo1=0;
-	int selectMacro9MatrixMixLfo2=0;
-	int selectMacro9FinalMixAndKeyLfo=0;
-
-	//menu procedures
-	void selectMacro9Menu();
-	void ifSelectMacro9();
-
-	//macro10
-	int selectMacro10Ch1Adjust=0;
-	int selectMacro10Ch2MixAndKey=0;
-	int selectMacro10Ch2Adjust=0;
-	int selectMacro10Ch1AdjustLfo=0;
-	int selectMacro10Ch2MixAndKeyLfo=0;
-	int selectMacro10Ch2AdjustLfo=0;
-	int selectMacro10Fb1MixAndKey=0;
-	int selectMacro10Fb1Geo1=0;
-	int selectMacro10Fb1Color1=0;
-	int selectMacro10Fb1Filters=0;
-	int selectMacro10Fb1MixAndKeyLfo=0;
-	int selectMacro10Fb1Geo1Lfo1=0;
-	int selectMacro10Fb1Geo1Lfo2=0;
-	int selectMacro10Fb1Color1Lfo1=0;
-
-	int selectMacro10Fb1DelayTime=0;
-	//b2
-	int selectMacro10Block2InputAdjust=0;
-	int selectMacro10Block2InputAdjustLfo=0;
-	int selectMacro10Fb2MixAndKey=0;
-	int selectMacro10Fb2Geo1=0;
-	int selectMacro10Fb2Color1=0;
-	int selectMacro10Fb2Filters=0;
-	int selectMacro10Fb2MixAndKeyLfo=0;
-	int selectMacro10Fb2Geo1Lfo1=0;
-	int selectMacro10Fb2Geo1Lfo2=0;
-	int selectMacro10Fb2Color1Lfo1=0;
-
-	int selectMacro10Fb2DelayTime=0;
-	//b3
-	int selectMacro10Block1Geo=0;
-	int selectMacro10Block1Colorize=0;
-	int selectMacro10Block1Filters=0;
-	int selectMacro10Block1Geo1Lfo1=0;
-	int selectMacro10Block1Geo1Lfo2=0;
-	int selectMacro10Block1ColorizeLfo1=0;
-	int selectMacro10Block1ColorizeLfo2=0;
-	int selectMacro10Block1ColorizeLfo3=0;
-	int selectMacro10Block2Geo=0;
-	int selectMacro10Block2Colorize=0;
-	int selectMacro10Block2Filters=0;
-	int selectMacro10Block2Geo1Lfo1=0;
-	int selectMacro10Block2Geo1Lfo2=0;
-	int selectMacro10Block2ColorizeLfo1=0;
-	int selectMacro10Block2ColorizeLfo2=0;
-	int selectMacro10Block2ColorizeLfo3=0;
-	int selectMacro10MatrixMix=0;
-	int selectMacro10FinalMixAndKey=0;
-	int selectMacro10MatrixMixLfo1=0;
-	int selectMacro10MatrixMixLfo2=0;
-	int selectMacro10FinalMixAndKeyLfo=0;
-
-	//menu procedures
-	void selectMacro10Menu();
-	void ifSelectMacro10();
-
-	//macro11
-	int selectMacro11Ch1Adjust=0;
-	int selectMacro11Ch2MixAndKey=0;
-	int selectMacro11Ch2Adjust=0;
-	int selectMacro11Ch1AdjustLfo=0;
-	int selectMacro11Ch2MixAndKeyLfo=0;
-	int selectMacro11Ch2AdjustLfo=0;
-	int selectMacro11Fb1MixAndKey=0;
-	int selectMacro11Fb1Geo1=0;
-	int selectMacro11Fb1Color1=0;
-	int selectMacro11Fb1Filters=0;
-	int selectMacro11Fb1MixAndKeyLfo=0;
-	int selectMacro11Fb1Geo1Lfo1=0;
-	int selectMacro11Fb1Geo1Lfo2=0;
-	int selectMacro11Fb1Color1Lfo1=0;
-
-	int selectMacro11Fb1DelayTime=0;
-	//b2
-	int selectMacro11Block2InputAdjust=0;
-	int selectMacro11Block2InputAdjustLfo=0;
-	int selectMacro11Fb2MixAndKey=0;
-	int selectMacro11Fb2Geo1=0;
-	int selectMacro11Fb2Color1=0;
-	int selectMacro11Fb2Filters=0;
-	int selectMacro11Fb2MixAndKeyLfo=0;
-	int selectMacro11Fb2Geo1Lfo1=0;
-	int selectMacro11Fb2Geo1Lfo2=0;
-	int selectMacro11Fb2Color1Lfo1=0;
-
-	int selectMacro11Fb2DelayTime=0;
-	//b3
-	int selectMacro11Block1Geo=0;
-	int selectMacro11Block1Colorize=0;
-	int selectMacro11Block1Filters=0;
-	int selectMacro11Block1Geo1Lfo1=0;
-	int selectMacro11Block1Geo1Lfo2=0;
-	int selectMacro11Block1ColorizeLfo1=0;
-	int selectMacro11Block1ColorizeLfo2=0;
-	int selectMacro11Block1ColorizeLfo3=0;
-	int selectMacro11Block2Geo=0;
-	int selectMacro11Block2Colorize=0;
-	int selectMacro11Block2Filters=0;
-	int selectMacro11Block2Geo1Lfo1=0;
-	int selectMacro11Block2Geo1Lfo2=0;
-	int selectMacro11Block2ColorizeLfo1=0;
-	int selectMacro11Block2ColorizeLfo2=0;
-	int selectMacro11Block2ColorizeLfo3=0;
-	int selectMacro11MatrixMix=0;
-	int selectMacro11FinalMixAndKey=0;
-	int selectMacro11MatrixMixLfo1=0;
-	int selectMacro11MatrixMixLfo2=0;
-	int selectMacro11FinalMixAndKeyLfo=0;
-
-	//menu procedures
-	void selectMacro11Menu();
-	void ifSelectMacro11();
-
-	//macro12
-	int selectMacro12Ch1Adjust=0;
-	int selectMacro12Ch2MixAndKey=0;
-	int selectMacro12Ch2Adjust=0;
-	int selectMacro12Ch1AdjustLfo=0;
-	int selectMacro12Ch2MixAndKeyLfo=0;
-	int selectMacro12Ch2AdjustLfo=0;
-	int selectMacro12Fb1MixAndKey=0;
-	int selectMacro12Fb1Geo1=0;
-	int selectMacro12Fb1Color1=0;
-	int selectMacro12Fb1Filters=0;
-	int selectMacro12Fb1MixAndKeyLfo=0;
-	int selectMacro12Fb1Geo1Lfo1=0;
-	int selectMacro12Fb1Geo1Lfo2=0;
-	int selectMacro12Fb1Color1Lfo1=0;
-
-	int selectMacro12Fb1DelayTime=0;
-	//b2
-	int selectMacro12Block2InputAdjust=0;
-	int selectMacro12Block2InputAdjustLfo=0;
-	int selectMacro12Fb2MixAndKey=0;
-	int selectMacro12Fb2Geo1=0;
-	int selectMacro12Fb2Color1=0;
-	int selectMacro12Fb2Filters=0;
-	int selectMacro12Fb2MixAndKeyLfo=0;
-	int selectMacro12Fb2Geo1Lfo1=0;
-	int selectMacro12Fb2Geo1Lfo2=0;
-	int selectMacro12Fb2Color1Lfo1=0;
-
-	int selectMacro12Fb2DelayTime=0;
-	//b3
-	int selectMacro12Block1Geo=0;
-	int selectMacro12Block1Colorize=0;
-	int selectMacro12Block1Filters=0;
-	int selectMacro12Block1Geo1Lfo1=0;
-	int selectMacro12Block1Geo1Lfo2=0;
-	int selectMacro12Block1ColorizeLfo1=0;
-	int selectMacro12Block1ColorizeLfo2=0;
-	int selectMacro12Block1ColorizeLfo3=0;
-	int selectMacro12Block2Geo=0;
-	int selectMacro12Block2Colorize=0;
-	int selectMacro12Block2Filters=0;
-	int selectMacro12Block2Geo1Lfo1=0;
-	int selectMacro12Block2Geo1Lfo2=0;
-	int selectMacro12Block2ColorizeLfo1=0;
-	int selectMacro12Block2ColorizeLfo2=0;
-	int selectMacro12Block2ColorizeLfo3=0;
-	int selectMacro12MatrixMix=0;
-	int selectMacro12FinalMixAndKey=0;
-	int selectMacro12MatrixMixLfo1=0;
-	int selectMacro12MatrixMixLfo2=0;
-	int selectMacro12FinalMixAndKeyLfo=0;
-
-	//menu procedures
-	void selectMacro12Menu();
-	void ifSelectMacro12();
-
-	//macro13
-	int selectMacro13Ch1Adjust=0;
-	int selectMacro13Ch2MixAndKey=0;
-	int selectMacro13Ch2Adjust=0;
-	int selectMacro13Ch1AdjustLfo=0;
-	int selectMacro13Ch2MixAndKeyLfo=0;
-	int selectMacro13Ch2AdjustLfo=0;
-	int selectMacro13Fb1MixAndKey=0;
-	int selectMacro13Fb1Geo1=0;
-	int selectMacro13Fb1Color1=0;
-	int selectMacro13Fb1Filters=0;
-	int selectMacro13Fb1MixAndKeyLfo=0;
-	int selectMacro13Fb1Geo1Lfo1=0;
-	int selectMacro13Fb1Geo1Lfo2=0;
-	int selectMacro13Fb1Color1Lfo1=0;
-
-	int selectMacro13Fb1DelayTime=0;
-	//b2
-	int selectMacro13Block2InputAdjust=0;
-	int selectMacro13Block2InputAdjustLfo=0;
-	int selectMacro13Fb2MixAndKey=0;
-	int selectMacro13Fb2Geo1=0;
-	int selectMacro13Fb2Color1=0;
-	int selectMacro13Fb2Filters=0;
-	int selectMacro13Fb2MixAndKeyLfo=0;
-	int selectMacro13Fb2Geo1Lfo1=0;
-	int selectMacro13Fb2Geo1Lfo2=0;
-	int selectMacro13Fb2Color1Lfo1=0;
-
-	int selectMacro13Fb2DelayTime=0;
-	//b3
-	int selectMacro13Block1Geo=0;
-	int selectMacro13Block1Colorize=0;
-	int selectMacro13Block1Filters=0;
-	int selectMacro13Block1Geo1Lfo1=0;
-	int selectMacro13Block1Geo1Lfo2=0;
-	int selectMacro13Block1ColorizeLfo1=0;
-	int selectMacro13Block1ColorizeLfo2=0;
-	int selectMacro13Block1ColorizeLfo3=0;
-	int selectMacro13Block2Geo=0;
-	int selectMacro13Block2Colorize=0;
-	int selectMacro13Block2Filters=0;
-	int selectMacro13Block2Geo1Lfo1=0;
-	int selectMacro13Block2Geo1Lfo2=0;
-	int selectMacro13Block2ColorizeLfo1=0;
-	int selectMacro13Block2ColorizeLfo2=0;
-	int selectMacro13Block2ColorizeLfo3=0;
-	int selectMacro13MatrixMix=0;
-	int selectMacro13FinalMixAndKey=0;
-	int selectMacro13MatrixMixLfo1=0;
-	int selectMacro13MatrixMixLfo2=0;
-	int selectMacro13FinalMixAndKeyLfo=0;
-
-	//menu procedures
-	void selectMacro13Menu();
-	void ifSelectMacro13();
-
-	//macro14
-	int selectMacro14Ch1Adjust=0;
-	int selectMacro14Ch2MixAndKey=0;
-	int selectMacro14Ch2Adjust=0;
-	int selectMacro14Ch1AdjustLfo=0;
-	int selectMacro14Ch2MixAndKeyLfo=0;
-	int selectMacro14Ch2AdjustLfo=0;
-	int selectMacro14Fb1MixAndKey=0;
-	int selectMacro14Fb1Geo1=0;
-	int selectMacro14Fb1Color1=0;
-	int selectMacro14Fb1Filters=0;
-	int selectMacro14Fb1MixAndKeyLfo=0;
-	int selectMacro14Fb1Geo1Lfo1=0;
-	int selectMacro14Fb1Geo1Lfo2=0;
-	int selectMacro14Fb1Color1Lfo1=0;
-
-	int selectMacro14Fb1DelayTime=0;
-	//b2
-	int selectMacro14Block2InputAdjust=0;
-	int selectMacro14Block2InputAdjustLfo=0;
-	int selectMacro14Fb2MixAndKey=0;
-	int selectMacro14Fb2Geo1=0;
-	int selectMacro14Fb2Color1=0;
-	int selectMacro14Fb2Filters=0;
-	int selectMacro14Fb2MixAndKeyLfo=0;
-	int selectMacro14Fb2Geo1Lfo1=0;
-	int selectMacro14Fb2Geo1Lfo2=0;
-	int selectMacro14Fb2Color1Lfo1=0;
-
-	int selectMacro14Fb2DelayTime=0;
-	//b3
-	int selectMacro14Block1Geo=0;
-	int selectMacro14Block1Colorize=0;
-	int selectMacro14Block1Filters=0;
-	int selectMacro14Block1Geo1Lfo1=0;
-	int selectMacro14Block1Geo1Lfo2=0;
-	int selectMacro14Block1ColorizeLfo1=0;
-	int selectMacro14Block1ColorizeLfo2=0;
-	int selectMacro14Block1ColorizeLfo3=0;
-	int selectMacro14Block2Geo=0;
-	int selectMacro14Block2Colorize=0;
-	int selectMacro14Block2Filters=0;
-	int selectMacro14Block2Geo1Lfo1=0;
-	int selectMacro14Block2Geo1Lfo2=0;
-	int selectMacro14Block2ColorizeLfo1=0;
-	int selectMacro14Block2ColorizeLfo2=0;
-	int selectMacro14Block2ColorizeLfo3=0;
-	int selectMacro14MatrixMix=0;
-	int selectMacro14FinalMixAndKey=0;
-	int selectMacro14MatrixMixLfo1=0;
-	int selectMacro14MatrixMixLfo2=0;
-	int selectMacro14FinalMixAndKeyLfo=0;
-
-	//menu procedures
-	void selectMacro14Menu();
-	void ifSelectMacro14();
-
-	//macro15
-	int selectMacro15Ch1Adjust=0;
-	int selectMacro15Ch2MixAndKey=0;
-	int selectMacro15Ch2Adjust=0;
-	int selectMacro15Ch1AdjustLfo=0;
-	int selectMacro15Ch2MixAndKeyLfo=0;
-	int selectMacro15Ch2AdjustLfo=0;
-	int selectMacro15Fb1MixAndKey=0;
-	int selectMacro15Fb1Geo1=0;
-	int selectMacro15Fb1Color1=0;
-	int selectMacro15Fb1Filters=0;
-	int selectMacro15Fb1MixAndKeyLfo=0;
-	int selectMacro15Fb1Geo1Lfo1=0;
-	int selectMacro15Fb1Geo1Lfo2=0;
-	int selectMacro15Fb1Color1Lfo1=0;
-
-	int selectMacro15Fb1DelayTime=0;
-	//b2
-	int selectMacro15Block2InputAdjust=0;
-	int selectMacro15Block2InputAdjustLfo=0;
-	int selectMacro15Fb2MixAndKey=0;
-	int selectMacro15Fb2Geo1=0;
-	int selectMacro15Fb2Color1=0;
-	int selectMacro15Fb2Filters=0;
-	int selectMacro15Fb2MixAndKeyLfo=0;
-	int selectMacro15Fb2Geo1Lfo1=0;
-	int selectMacro15Fb2Geo1Lfo2=0;
-	int selectMacro15Fb2Color1Lfo1=0;
-
-	int selectMacro15Fb2DelayTime=0;
-	//b3
-	int selectMacro15Block1Geo=0;
-	int selectMacro15Block1Colorize=0;
-	int selectMacro15Block1Filters=0;
-	int selectMacro15Block1Geo1Lfo1=0;
-	int selectMacro15Block1Geo1Lfo2=0;
-	int selectMacro15Block1ColorizeLfo1=0;
-	int selectMacro15Block1ColorizeLfo2=0;
-	int selectMacro15Block1ColorizeLfo3=0;
-	int selectMacro15Block2Geo=0;
-	int selectMacro15Block2Colorize=0;
-	int selectMacro15Block2Filters=0;
-	int selectMacro15Block2Geo1Lfo1=0;
-	int selectMacro15Block2Geo1Lfo2=0;
-	int selectMacro15Block2ColorizeLfo1=0;
-	int selectMacro15Block2ColorizeLfo2=0;
-	int selectMacro15Block2ColorizeLfo3=0;
-	int selectMacro15MatrixMix=0;
-	int selectMacro15FinalMixAndKey=0;
-	int selectMacro15MatrixMixLfo1=0;
-	int selectMacro15MatrixMixLfo2=0;
-	int selectMacro15FinalMixAndKeyLfo=0;
-
-	//menu procedures
-	void selectMacro15Menu();
-	void ifSelectMacro15();
-
 
 	/**gui**/
 	ofxImGui::Gui gui;
@@ -1407,10 +483,10 @@ public:
 	/*Arrays & midi 2 gui*/
 	void allArrayClear();
 	void midi2Gui(bool midiActive[], float params[], bool midiSwitch);
+	void controlUpdate();
 
 	//reset
 	void resetAll();
-	void allButtonsClear();
 
 	// OSC-triggered reset switches
 	bool resetAllSwitch = 0;
@@ -1469,6 +545,72 @@ public:
 	//ch1 and ch2 input resets
 	void block1InputResetAll();
 
+	// ============== PARAMETER STORE ==============
+	// Every parameter group is a PARAMETER_ARRAY_LENGTH slice of one flat
+	// array, so presets, resets and randomizing are plain loops over the
+	// store. The per group names below are views into it.
+	enum ParamGroupId {
+		GROUP_CH1_ADJUST,
+		GROUP_CH1_ADJUST_LFO,
+		GROUP_CH2_MIX_AND_KEY,
+		GROUP_CH2_MIX_AND_KEY_LFO,
+		GROUP_CH2_ADJUST,
+		GROUP_CH2_ADJUST_LFO,
+		GROUP_FB1_MIX_AND_KEY,
+		GROUP_FB1_GEO1,
+		GROUP_FB1_COLOR1,
+		GROUP_FB1_FILTERS,
+		GROUP_FB1_MIX_AND_KEY_LFO,
+		GROUP_FB1_GEO1_LFO1,
+		GROUP_FB1_GEO1_LFO2,
+		GROUP_FB1_COLOR1_LFO1,
+		GROUP_BLOCK2_INPUT_ADJUST,
+		GROUP_BLOCK2_INPUT_ADJUST_LFO,
+		GROUP_FB2_MIX_AND_KEY,
+		GROUP_FB2_GEO1,
+		GROUP_FB2_COLOR1,
+		GROUP_FB2_FILTERS,
+		GROUP_FB2_MIX_AND_KEY_LFO,
+		GROUP_FB2_GEO1_LFO1,
+		GROUP_FB2_GEO1_LFO2,
+		GROUP_FB2_COLOR1_LFO1,
+		GROUP_BLOCK1_GEO,
+		GROUP_BLOCK1_COLORIZE,
+		GROUP_BLOCK1_FILTERS,
+		GROUP_BLOCK1_GEO1_LFO1,
+		GROUP_BLOCK1_GEO1_LFO2,
+		GROUP_BLOCK1_COLORIZE_LFO1,
+		GROUP_BLOCK1_COLORIZE_LFO2,
+		GROUP_BLOCK1_COLORIZE_LFO3,
+		GROUP_BLOCK1_COLOR1_LFO1,
+		GROUP_BLOCK2_GEO,
+		GROUP_BLOCK2_COLORIZE,
+		GROUP_BLOCK2_FILTERS,
+		GROUP_BLOCK2_GEO1_LFO1,
+		GROUP_BLOCK2_GEO1_LFO2,
+		GROUP_BLOCK2_COLORIZE_LFO1,
+		GROUP_BLOCK2_COLORIZE_LFO2,
+		GROUP_BLOCK2_COLORIZE_LFO3,
+		GROUP_MATRIX_MIX,
+		GROUP_FINAL_MIX_AND_KEY,
+		GROUP_MATRIX_MIX_LFO1,
+		GROUP_MATRIX_MIX_LFO2,
+		GROUP_FINAL_MIX_AND_KEY_LFO,
+		PARAM_GROUP_COUNT
+	};
+
+	float paramStore[PARAM_GROUP_COUNT*PARAMETER_ARRAY_LENGTH]={};
+	bool paramMidiActiveStore[PARAM_GROUP_COUNT*PARAMETER_ARRAY_LENGTH]={};
+	int paramLfoShapeStore[PARAM_GROUP_COUNT*PARAMETER_ARRAY_LENGTH]={};
+
+	float* groupValues(ParamGroupId id){ return paramStore+id*PARAMETER_ARRAY_LENGTH; }
+	bool* groupMidiActive(ParamGroupId id){ return paramMidiActiveStore+id*PARAMETER_ARRAY_LENGTH; }
+	int* groupShapes(ParamGroupId id){ return paramLfoShapeStore+id*PARAMETER_ARRAY_LENGTH; }
+
+	// Preset slot, OSC address, default and reset scope of every parameter
+	ParameterSchema parameterSchema;
+	void initializeParameterSchema();
+
 	//ch1 parameters
 	int ch1InputSelect=0; //0 is input1, 1 is input2
 	bool ch1AspectRatioSwitch=0; //0 is 4:3, 1 is 16:9
@@ -1476,8 +618,8 @@ public:
 	//ch1 midi syncing & parameter bizness
 	bool ch1AdjustMidiGui=0;
 	bool ch1AdjustReset=0;
-	float ch1Adjust[PARAMETER_ARRAY_LENGTH];
-	bool ch1AdjustMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const ch1Adjust=groupValues(GROUP_CH1_ADJUST);
+	bool* const ch1AdjustMidiActive=groupMidiActive(GROUP_CH1_ADJUST);
 
 	bool ch1HMirror=0;
 	bool ch1VMirror=0;
@@ -1494,8 +636,8 @@ public:
 	//ch1 adjust lfo midi syncing & parameter bizness
 	bool ch1AdjustLfoMidiGui=0;
 	bool ch1AdjustLfoReset=0;
-	float ch1AdjustLfo[PARAMETER_ARRAY_LENGTH];
-	bool ch1AdjustLfoMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const ch1AdjustLfo=groupValues(GROUP_CH1_ADJUST_LFO);
+	bool* const ch1AdjustLfoMidiActive=groupMidiActive(GROUP_CH1_ADJUST_LFO);
 
 	//ch2 parameters
 	int ch2InputSelect=1; //0 is input1, 1 is input2
@@ -1504,8 +646,8 @@ public:
 	//ch2 pmidi syncing & paramater bizness
 	bool ch2MixAndKeyMidiGui=0;
 	bool ch2MixAndKeyReset=0;
-	float ch2MixAndKey[PARAMETER_ARRAY_LENGTH];
-	bool ch2MixAndKeyMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const ch2MixAndKey=groupValues(GROUP_CH2_MIX_AND_KEY);
+	bool* const ch2MixAndKeyMidiActive=groupMidiActive(GROUP_CH2_MIX_AND_KEY);
 
 	int ch2KeyOrder=0;
 	int ch2MixType=0;
@@ -1515,14 +657,14 @@ public:
 	//ch2 pmidi syncing & paramater bizness
 	bool ch2MixAndKeyLfoMidiGui=0;
 	bool ch2MixAndKeyLfoReset=0;
-	float ch2MixAndKeyLfo[PARAMETER_ARRAY_LENGTH];
-	bool ch2MixAndKeyLfoMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const ch2MixAndKeyLfo=groupValues(GROUP_CH2_MIX_AND_KEY_LFO);
+	bool* const ch2MixAndKeyLfoMidiActive=groupMidiActive(GROUP_CH2_MIX_AND_KEY_LFO);
 
 	//ch2 midi syncing & parameter bizness
 	bool ch2AdjustMidiGui=0;
 	bool ch2AdjustReset=0;
-	float ch2Adjust[PARAMETER_ARRAY_LENGTH];
-	bool ch2AdjustMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const ch2Adjust=groupValues(GROUP_CH2_ADJUST);
+	bool* const ch2AdjustMidiActive=groupMidiActive(GROUP_CH2_ADJUST);
 
 	bool ch2HMirror=0;
 	bool ch2VMirror=0;
@@ -1538,8 +680,8 @@ public:
 	//ch2 adjust lfo midi syncing & parameter bizness
 	bool ch2AdjustLfoMidiGui=0;
 	bool ch2AdjustLfoReset=0;
-	float ch2AdjustLfo[PARAMETER_ARRAY_LENGTH];
-	bool ch2AdjustLfoMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const ch2AdjustLfo=groupValues(GROUP_CH2_ADJUST_LFO);
+	bool* const ch2AdjustLfoMidiActive=groupMidiActive(GROUP_CH2_ADJUST_LFO);
 
 	//fb1 reset
 	void fb1ResetAll();
@@ -1549,8 +691,8 @@ public:
 	//fb1 mixnkey pmidi syncing & paramater bizness
 	bool fb1MixAndKeyMidiGui=0;
 	bool fb1MixAndKeyReset=0;
-	float fb1MixAndKey[PARAMETER_ARRAY_LENGTH];
-	bool fb1MixAndKeyMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const fb1MixAndKey=groupValues(GROUP_FB1_MIX_AND_KEY);
+	bool* const fb1MixAndKeyMidiActive=groupMidiActive(GROUP_FB1_MIX_AND_KEY);
 
 	int fb1KeyOrder=0;
 	int fb1MixType=0;
@@ -1563,8 +705,8 @@ public:
 	//fb1 geo1 pmidi syncing & paramater bizness
 	bool fb1Geo1MidiGui=0;
 	bool fb1Geo1Reset=0;
-	float fb1Geo1[PARAMETER_ARRAY_LENGTH];
-	bool fb1Geo1MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const fb1Geo1=groupValues(GROUP_FB1_GEO1);
+	bool* const fb1Geo1MidiActive=groupMidiActive(GROUP_FB1_GEO1);
 
 	bool fb1HMirror=0;
 	bool fb1VMirror=0;
@@ -1577,8 +719,8 @@ public:
 	//fb1 color1 pmidi syncing & paramater bizness
 	bool fb1Color1MidiGui=0;
 	bool fb1Color1Reset=0;
-	float fb1Color1[PARAMETER_ARRAY_LENGTH];
-	bool fb1Color1MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const fb1Color1=groupValues(GROUP_FB1_COLOR1);
+	bool* const fb1Color1MidiActive=groupMidiActive(GROUP_FB1_COLOR1);
 
 	bool fb1HueInvert=0;
 	bool fb1SaturationInvert=0;
@@ -1587,34 +729,34 @@ public:
 	//fb1 filters pmidi syncing & paramater bizness
 	bool fb1FiltersMidiGui=0;
 	bool fb1FiltersReset=0;
-	float fb1Filters[PARAMETER_ARRAY_LENGTH];
-	bool fb1FiltersMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const fb1Filters=groupValues(GROUP_FB1_FILTERS);
+	bool* const fb1FiltersMidiActive=groupMidiActive(GROUP_FB1_FILTERS);
 
 
 	//fb1 LFO
 	//fb1 mixnkey pmidi syncing & paramater bizness
 	bool fb1MixAndKeyLfoMidiGui=0;
 	bool fb1MixAndKeyLfoReset=0;
-	float fb1MixAndKeyLfo[PARAMETER_ARRAY_LENGTH];
-	bool fb1MixAndKeyLfoMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const fb1MixAndKeyLfo=groupValues(GROUP_FB1_MIX_AND_KEY_LFO);
+	bool* const fb1MixAndKeyLfoMidiActive=groupMidiActive(GROUP_FB1_MIX_AND_KEY_LFO);
 
 	//fb1 Geo1Lfo1 pmidi syncing & paramater bizness
 	bool fb1Geo1Lfo1MidiGui=0;
 	bool fb1Geo1Lfo1Reset=0;
-	float fb1Geo1Lfo1[PARAMETER_ARRAY_LENGTH];
-	bool fb1Geo1Lfo1MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const fb1Geo1Lfo1=groupValues(GROUP_FB1_GEO1_LFO1);
+	bool* const fb1Geo1Lfo1MidiActive=groupMidiActive(GROUP_FB1_GEO1_LFO1);
 
 	//fb1 Geo1Lfo2 pmidi syncing & paramater bizness
 	bool fb1Geo1Lfo2MidiGui=0;
 	bool fb1Geo1Lfo2Reset=0;
-	float fb1Geo1Lfo2[PARAMETER_ARRAY_LENGTH];
-	bool fb1Geo1Lfo2MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const fb1Geo1Lfo2=groupValues(GROUP_FB1_GEO1_LFO2);
+	bool* const fb1Geo1Lfo2MidiActive=groupMidiActive(GROUP_FB1_GEO1_LFO2);
 
 	//fb1 Color1Lfo1 pmidi syncing & paramater bizness
 	bool fb1Color1Lfo1MidiGui=0;
 	bool fb1Color1Lfo1Reset=0;
-	float fb1Color1Lfo1[PARAMETER_ARRAY_LENGTH];
-	bool fb1Color1Lfo1MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const fb1Color1Lfo1=groupValues(GROUP_FB1_COLOR1_LFO1);
+	bool* const fb1Color1Lfo1MidiActive=groupMidiActive(GROUP_FB1_COLOR1_LFO1);
 
 	//geometrical animations
 	//hypercube
@@ -1734,6 +876,20 @@ public:
 	float lissajous1ChopRatioLfoRate = 0.0f;
 	int   lissajous1ChopRatioLfoShape = 0;
 
+	// Instancing: the curve is drawn count times, each copy offset in phase,
+	// hue and scale by up to spread
+	static const int LISSAJOUS_MAX_COUNT = 64;
+	int   lissajous1Count = 1;
+	float lissajous1Spread = 0.0f;
+
+	// ============== PARTICLES - BLOCK 1 ==============
+	bool block1ParticlesSwitch = 0;
+	float particles1Amount = 0.25f;
+	float particles1Speed = 0.5f;
+	float particles1Flow = 0.5f;
+	float particles1Size = 0.1f;
+	float particles1Hue = 0.5f;
+
 
 	//BLOCK2 input
 	void block2ResetAll();
@@ -1747,8 +903,8 @@ public:
 	//block2Input midi syncing & parameter bizness
 	bool block2InputAdjustMidiGui=0;
 	bool block2InputAdjustReset=0;
-	float block2InputAdjust[PARAMETER_ARRAY_LENGTH];
-	bool block2InputAdjustMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const block2InputAdjust=groupValues(GROUP_BLOCK2_INPUT_ADJUST);
+	bool* const block2InputAdjustMidiActive=groupMidiActive(GROUP_BLOCK2_INPUT_ADJUST);
 
 	bool block2InputHMirror=0;
 	bool block2InputVMirror=0;
@@ -1765,8 +921,8 @@ public:
 	//block2Input adjust lfo midi syncing & parameter bizness
 	bool block2InputAdjustLfoMidiGui=0;
 	bool block2InputAdjustLfoReset=0;
-	float block2InputAdjustLfo[PARAMETER_ARRAY_LENGTH];
-	bool block2InputAdjustLfoMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const block2InputAdjustLfo=groupValues(GROUP_BLOCK2_INPUT_ADJUST_LFO);
+	bool* const block2InputAdjustLfoMidiActive=groupMidiActive(GROUP_BLOCK2_INPUT_ADJUST_LFO);
 
 
 
@@ -1776,8 +932,8 @@ public:
 	//fb2 mixnkey pmidi syncing & paramater bizness
 	bool fb2MixAndKeyMidiGui=0;
 	bool fb2MixAndKeyReset=0;
-	float fb2MixAndKey[PARAMETER_ARRAY_LENGTH];
-	bool fb2MixAndKeyMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const fb2MixAndKey=groupValues(GROUP_FB2_MIX_AND_KEY);
+	bool* const fb2MixAndKeyMidiActive=groupMidiActive(GROUP_FB2_MIX_AND_KEY);
 
 	int fb2KeyOrder=0;
 	int fb2MixType=0;
@@ -1789,8 +945,8 @@ public:
 	//fb2 geo1 pmidi syncing & paramater bizness
 	bool fb2Geo1MidiGui=0;
 	bool fb2Geo1Reset=0;
-	float fb2Geo1[PARAMETER_ARRAY_LENGTH];
-	bool fb2Geo1MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const fb2Geo1=groupValues(GROUP_FB2_GEO1);
+	bool* const fb2Geo1MidiActive=groupMidiActive(GROUP_FB2_GEO1);
 
 	bool fb2HMirror=0;
 	bool fb2VMirror=0;
@@ -1802,8 +958,8 @@ public:
 	//fb2 color1 pmidi syncing & paramater bizness
 	bool fb2Color1MidiGui=0;
 	bool fb2Color1Reset=0;
-	float fb2Color1[PARAMETER_ARRAY_LENGTH];
-	bool fb2Color1MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const fb2Color1=groupValues(GROUP_FB2_COLOR1);
+	bool* const fb2Color1MidiActive=groupMidiActive(GROUP_FB2_COLOR1);
 
 	bool fb2HueInvert=0;
 	bool fb2SaturationInvert=0;
@@ -1812,34 +968,34 @@ public:
 	//fb2 filters pmidi syncing & paramater bizness
 	bool fb2FiltersMidiGui=0;
 	bool fb2FiltersReset=0;
-	float fb2Filters[PARAMETER_ARRAY_LENGTH];
-	bool fb2FiltersMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const fb2Filters=groupValues(GROUP_FB2_FILTERS);
+	bool* const fb2FiltersMidiActive=groupMidiActive(GROUP_FB2_FILTERS);
 
 
 	//fb2 LFO
 	//fb2 mixnkey pmidi syncing & paramater bizness
 	bool fb2MixAndKeyLfoMidiGui=0;
 	bool fb2MixAndKeyLfoReset=0;
-	float fb2MixAndKeyLfo[PARAMETER_ARRAY_LENGTH];
-	bool fb2MixAndKeyLfoMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const fb2MixAndKeyLfo=groupValues(GROUP_FB2_MIX_AND_KEY_LFO);
+	bool* const fb2MixAndKeyLfoMidiActive=groupMidiActive(GROUP_FB2_MIX_AND_KEY_LFO);
 
 	//fb2 Geo1Lfo1 pmidi syncing & paramater bizness
 	bool fb2Geo1Lfo1MidiGui=0;
 	bool fb2Geo1Lfo1Reset=0;
-	float fb2Geo1Lfo1[PARAMETER_ARRAY_LENGTH];
-	bool fb2Geo1Lfo1MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const fb2Geo1Lfo1=groupValues(GROUP_FB2_GEO1_LFO1);
+	bool* const fb2Geo1Lfo1MidiActive=groupMidiActive(GROUP_FB2_GEO1_LFO1);
 
 	//fb2 Geo1Lfo2 pmidi syncing & paramater bizness
 	bool fb2Geo1Lfo2MidiGui=0;
 	bool fb2Geo1Lfo2Reset=0;
-	float fb2Geo1Lfo2[PARAMETER_ARRAY_LENGTH];
-	bool fb2Geo1Lfo2MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const fb2Geo1Lfo2=groupValues(GROUP_FB2_GEO1_LFO2);
+	bool* const fb2Geo1Lfo2MidiActive=groupMidiActive(GROUP_FB2_GEO1_LFO2);
 
 	//fb2 Color1Lfo1 pmidi syncing & paramater bizness
 	bool fb2Color1Lfo1MidiGui=0;
 	bool fb2Color1Lfo1Reset=0;
-	float fb2Color1Lfo1[PARAMETER_ARRAY_LENGTH];
-	bool fb2Color1Lfo1MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const fb2Color1Lfo1=groupValues(GROUP_FB2_COLOR1_LFO1);
+	bool* const fb2Color1Lfo1MidiActive=groupMidiActive(GROUP_FB2_COLOR1_LFO1);
 
 	//block2 geometrical animations
 	//hypercube
@@ -1955,6 +1111,18 @@ public:
 	float lissajous2ChopRatioLfoRate = 0.0f;
 	int   lissajous2ChopRatioLfoShape = 0;
 
+	// Instancing, as for block 1
+	int   lissajous2Count = 1;
+	float lissajous2Spread = 0.0f;
+
+	// ============== PARTICLES - BLOCK 2 ==============
+	bool block2ParticlesSwitch = 0;
+	float particles2Amount = 0.25f;
+	float particles2Speed = 0.5f;
+	float particles2Flow = 0.5f;
+	float particles2Size = 0.1f;
+	float particles2Hue = 0.5f;
+
 	//BLOCK3
 
 
@@ -1966,8 +1134,8 @@ public:
 	//block1 Geo pmidi syncing & paramater bizness
 	bool block1GeoMidiGui=0;
 	bool block1GeoReset=0;
-	float block1Geo[PARAMETER_ARRAY_LENGTH];
-	bool block1GeoMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const block1Geo=groupValues(GROUP_BLOCK1_GEO);
+	bool* const block1GeoMidiActive=groupMidiActive(GROUP_BLOCK1_GEO);
 
 	int block1GeoOverflow=0;
 	bool block1HMirror=0;
@@ -1979,8 +1147,8 @@ public:
 	//block1 Colorize
 	bool block1ColorizeMidiGui=0;
 	bool block1ColorizeReset=0;
-	float block1Colorize[PARAMETER_ARRAY_LENGTH];
-	bool block1ColorizeMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const block1Colorize=groupValues(GROUP_BLOCK1_COLORIZE);
+	bool* const block1ColorizeMidiActive=groupMidiActive(GROUP_BLOCK1_COLORIZE);
 
 	bool block1ColorizeSwitch=0;
 	bool block1ColorizeHSB_RGB=0;//0 is hsb, 1 is rgb
@@ -1988,39 +1156,39 @@ public:
 	//block1 filters pmidi syncing & paramater bizness
 	bool block1FiltersMidiGui=0;
 	bool block1FiltersReset=0;
-	float block1Filters[PARAMETER_ARRAY_LENGTH];
-	bool block1FiltersMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const block1Filters=groupValues(GROUP_BLOCK1_FILTERS);
+	bool* const block1FiltersMidiActive=groupMidiActive(GROUP_BLOCK1_FILTERS);
 	int block1DitherType=1;
 
 	//block1 Geo1Lfo1 pmidi syncing & paramater bizness
 	bool block1Geo1Lfo1MidiGui=0;
 	bool block1Geo1Lfo1Reset=0;
-	float block1Geo1Lfo1[PARAMETER_ARRAY_LENGTH];
-	bool block1Geo1Lfo1MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const block1Geo1Lfo1=groupValues(GROUP_BLOCK1_GEO1_LFO1);
+	bool* const block1Geo1Lfo1MidiActive=groupMidiActive(GROUP_BLOCK1_GEO1_LFO1);
 
 	//block1 Geo1Lfo2 pmidi syncing & paramater bizness
 	bool block1Geo1Lfo2MidiGui=0;
 	bool block1Geo1Lfo2Reset=0;
-	float block1Geo1Lfo2[PARAMETER_ARRAY_LENGTH];
-	bool block1Geo1Lfo2MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const block1Geo1Lfo2=groupValues(GROUP_BLOCK1_GEO1_LFO2);
+	bool* const block1Geo1Lfo2MidiActive=groupMidiActive(GROUP_BLOCK1_GEO1_LFO2);
 
 	//block1 ColorizeLfo1
 	bool block1ColorizeLfo1MidiGui=0;
 	bool block1ColorizeLfo1Reset=0;
-	float block1ColorizeLfo1[PARAMETER_ARRAY_LENGTH];
-	bool block1ColorizeLfo1MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const block1ColorizeLfo1=groupValues(GROUP_BLOCK1_COLORIZE_LFO1);
+	bool* const block1ColorizeLfo1MidiActive=groupMidiActive(GROUP_BLOCK1_COLORIZE_LFO1);
 
 	//block1 ColorizeLfo2
 	bool block1ColorizeLfo2MidiGui=0;
 	bool block1ColorizeLfo2Reset=0;
-	float block1ColorizeLfo2[PARAMETER_ARRAY_LENGTH];
-	bool block1ColorizeLfo2MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const block1ColorizeLfo2=groupValues(GROUP_BLOCK1_COLORIZE_LFO2);
+	bool* const block1ColorizeLfo2MidiActive=groupMidiActive(GROUP_BLOCK1_COLORIZE_LFO2);
 
 	//block1 ColorizeLfo3
 	bool block1ColorizeLfo3MidiGui=0;
 	bool block1ColorizeLfo3Reset=0;
-	float block1ColorizeLfo3[PARAMETER_ARRAY_LENGTH];
-	bool block1ColorizeLfo3MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const block1ColorizeLfo3=groupValues(GROUP_BLOCK1_COLORIZE_LFO3);
+	bool* const block1ColorizeLfo3MidiActive=groupMidiActive(GROUP_BLOCK1_COLORIZE_LFO3);
 
 
 
@@ -2032,8 +1200,8 @@ public:
 	//block1 Color1Lfo1 pmidi syncing & paramater bizness
 	bool block1Color1Lfo1MidiGui=0;
 	bool block1Color1Lfo1Reset=0;
-	float block1Color1Lfo1[PARAMETER_ARRAY_LENGTH];
-	bool block1Color1Lfo1MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const block1Color1Lfo1=groupValues(GROUP_BLOCK1_COLOR1_LFO1);
+	bool* const block1Color1Lfo1MidiActive=groupMidiActive(GROUP_BLOCK1_COLOR1_LFO1);
 
 
 
@@ -2043,8 +1211,8 @@ public:
 	//block2 Geo pmidi syncing & paramater bizness
 	bool block2GeoMidiGui=0;
 	bool block2GeoReset=0;
-	float block2Geo[PARAMETER_ARRAY_LENGTH];
-	bool block2GeoMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const block2Geo=groupValues(GROUP_BLOCK2_GEO);
+	bool* const block2GeoMidiActive=groupMidiActive(GROUP_BLOCK2_GEO);
 
 	int block2GeoOverflow=0;
 	bool block2HMirror=0;
@@ -2056,8 +1224,8 @@ public:
 	//block2 Colorize
 	bool block2ColorizeMidiGui=0;
 	bool block2ColorizeReset=0;
-	float block2Colorize[PARAMETER_ARRAY_LENGTH];
-	bool block2ColorizeMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const block2Colorize=groupValues(GROUP_BLOCK2_COLORIZE);
+	bool* const block2ColorizeMidiActive=groupMidiActive(GROUP_BLOCK2_COLORIZE);
 
 	bool block2ColorizeSwitch=0;
 	bool block2ColorizeHSB_RGB=0;
@@ -2065,47 +1233,47 @@ public:
 	//block2 filters pmidi syncing & paramater bizness
 	bool block2FiltersMidiGui=0;
 	bool block2FiltersReset=0;
-	float block2Filters[PARAMETER_ARRAY_LENGTH];
-	bool block2FiltersMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const block2Filters=groupValues(GROUP_BLOCK2_FILTERS);
+	bool* const block2FiltersMidiActive=groupMidiActive(GROUP_BLOCK2_FILTERS);
 	int block2DitherType=1;
 
 	//block2 Geo1Lfo1 pmidi syncing & paramater bizness
 	bool block2Geo1Lfo1MidiGui=0;
 	bool block2Geo1Lfo1Reset=0;
-	float block2Geo1Lfo1[PARAMETER_ARRAY_LENGTH];
-	bool block2Geo1Lfo1MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const block2Geo1Lfo1=groupValues(GROUP_BLOCK2_GEO1_LFO1);
+	bool* const block2Geo1Lfo1MidiActive=groupMidiActive(GROUP_BLOCK2_GEO1_LFO1);
 
 	//block2 Geo1Lfo2 pmidi syncing & paramater bizness
 	bool block2Geo1Lfo2MidiGui=0;
 	bool block2Geo1Lfo2Reset=0;
-	float block2Geo1Lfo2[PARAMETER_ARRAY_LENGTH];
-	bool block2Geo1Lfo2MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const block2Geo1Lfo2=groupValues(GROUP_BLOCK2_GEO1_LFO2);
+	bool* const block2Geo1Lfo2MidiActive=groupMidiActive(GROUP_BLOCK2_GEO1_LFO2);
 
 	//block2 ColorizeLfo1
 	bool block2ColorizeLfo1MidiGui=0;
 	bool block2ColorizeLfo1Reset=0;
-	float block2ColorizeLfo1[PARAMETER_ARRAY_LENGTH];
-	bool block2ColorizeLfo1MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const block2ColorizeLfo1=groupValues(GROUP_BLOCK2_COLORIZE_LFO1);
+	bool* const block2ColorizeLfo1MidiActive=groupMidiActive(GROUP_BLOCK2_COLORIZE_LFO1);
 
 	//block2 ColorizeLfo2
 	bool block2ColorizeLfo2MidiGui=0;
 	bool block2ColorizeLfo2Reset=0;
-	float block2ColorizeLfo2[PARAMETER_ARRAY_LENGTH];
-	bool block2ColorizeLfo2MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const block2ColorizeLfo2=groupValues(GROUP_BLOCK2_COLORIZE_LFO2);
+	bool* const block2ColorizeLfo2MidiActive=groupMidiActive(GROUP_BLOCK2_COLORIZE_LFO2);
 
 	//block2 ColorizeLfo3
 	bool block2ColorizeLfo3MidiGui=0;
 	bool block2ColorizeLfo3Reset=0;
-	float block2ColorizeLfo3[PARAMETER_ARRAY_LENGTH];
-	bool block2ColorizeLfo3MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const block2ColorizeLfo3=groupValues(GROUP_BLOCK2_COLORIZE_LFO3);
+	bool* const block2ColorizeLfo3MidiActive=groupMidiActive(GROUP_BLOCK2_COLORIZE_LFO3);
 
 
 
 	//matrix mixer
 	bool matrixMixMidiGui=0;
 	bool matrixMixReset=0;
-	float matrixMix[PARAMETER_ARRAY_LENGTH];
-	bool matrixMixMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const matrixMix=groupValues(GROUP_MATRIX_MIX);
+	bool* const matrixMixMidiActive=groupMidiActive(GROUP_MATRIX_MIX);
 
 	int matrixMixType=0;
 	int matrixMixOverflow=0;
@@ -2113,8 +1281,8 @@ public:
 	//final mix pmidi syncing & paramater bizness
 	bool finalMixAndKeyMidiGui=0;
 	bool finalMixAndKeyReset=0;
-	float finalMixAndKey[PARAMETER_ARRAY_LENGTH];
-	bool finalMixAndKeyMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const finalMixAndKey=groupValues(GROUP_FINAL_MIX_AND_KEY);
+	bool* const finalMixAndKeyMidiActive=groupMidiActive(GROUP_FINAL_MIX_AND_KEY);
 
 	int finalKeyOrder=0;
 	int finalMixType=0;
@@ -2124,49 +1292,49 @@ public:
 	//matrix mixer lfo
 	bool matrixMixLfo1MidiGui=0;
 	bool matrixMixLfo1Reset=0;
-	float matrixMixLfo1[PARAMETER_ARRAY_LENGTH];
-	bool matrixMixLfo1MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const matrixMixLfo1=groupValues(GROUP_MATRIX_MIX_LFO1);
+	bool* const matrixMixLfo1MidiActive=groupMidiActive(GROUP_MATRIX_MIX_LFO1);
 
 	bool matrixMixLfo2MidiGui=0;
 	bool matrixMixLfo2Reset=0;
-	float matrixMixLfo2[PARAMETER_ARRAY_LENGTH];
-	bool matrixMixLfo2MidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const matrixMixLfo2=groupValues(GROUP_MATRIX_MIX_LFO2);
+	bool* const matrixMixLfo2MidiActive=groupMidiActive(GROUP_MATRIX_MIX_LFO2);
 
 	//final mixnkey pmidi syncing & paramater bizness
 	bool finalMixAndKeyLfoMidiGui=0;
 	bool finalMixAndKeyLfoReset=0;
-	float finalMixAndKeyLfo[PARAMETER_ARRAY_LENGTH];
-	bool finalMixAndKeyLfoMidiActive[PARAMETER_ARRAY_LENGTH];
+	float* const finalMixAndKeyLfo=groupValues(GROUP_FINAL_MIX_AND_KEY_LFO);
+	bool* const finalMixAndKeyLfoMidiActive=groupMidiActive(GROUP_FINAL_MIX_AND_KEY_LFO);
 
 	// ============== LFO SHAPE ARRAYS ==============
 	// LFO Shape arrays - one int per parameter pair
 	// Shape values: 0=Sine, 1=Triangle, 2=Ramp, 3=Saw, 4=Square
-	int ch1AdjustLfoShape[PARAMETER_ARRAY_LENGTH];         // 8 shapes used (indices 0-7)
-	int ch2MixAndKeyLfoShape[PARAMETER_ARRAY_LENGTH];      // 3 shapes used (indices 0-2)
-	int ch2AdjustLfoShape[PARAMETER_ARRAY_LENGTH];         // 8 shapes used
-	int fb1MixAndKeyLfoShape[PARAMETER_ARRAY_LENGTH];      // 3 shapes used
-	int fb1Geo1Lfo1Shape[PARAMETER_ARRAY_LENGTH];          // 4 shapes used
-	int fb1Geo1Lfo2Shape[PARAMETER_ARRAY_LENGTH];          // 5 shapes used
-	int fb1Color1Lfo1Shape[PARAMETER_ARRAY_LENGTH];        // 3 shapes used
-	int block2InputAdjustLfoShape[PARAMETER_ARRAY_LENGTH]; // 8 shapes used
-	int fb2MixAndKeyLfoShape[PARAMETER_ARRAY_LENGTH];      // 3 shapes used
-	int fb2Geo1Lfo1Shape[PARAMETER_ARRAY_LENGTH];          // 4 shapes used
-	int fb2Geo1Lfo2Shape[PARAMETER_ARRAY_LENGTH];          // 5 shapes used
-	int fb2Color1Lfo1Shape[PARAMETER_ARRAY_LENGTH];        // 3 shapes used
-	int block1Geo1Lfo1Shape[PARAMETER_ARRAY_LENGTH];       // 4 shapes used
-	int block1Geo1Lfo2Shape[PARAMETER_ARRAY_LENGTH];       // 5 shapes used
-	int block1ColorizeLfo1Shape[PARAMETER_ARRAY_LENGTH];   // 6 shapes used
-	int block1ColorizeLfo2Shape[PARAMETER_ARRAY_LENGTH];   // 6 shapes used
-	int block1ColorizeLfo3Shape[PARAMETER_ARRAY_LENGTH];   // 3 shapes used
-	int block1Color1Lfo1Shape[PARAMETER_ARRAY_LENGTH];     // (legacy - may not be used)
-	int block2Geo1Lfo1Shape[PARAMETER_ARRAY_LENGTH];       // 4 shapes used
-	int block2Geo1Lfo2Shape[PARAMETER_ARRAY_LENGTH];       // 5 shapes used
-	int block2ColorizeLfo1Shape[PARAMETER_ARRAY_LENGTH];   // 6 shapes used
-	int block2ColorizeLfo2Shape[PARAMETER_ARRAY_LENGTH];   // 6 shapes used
-	int block2ColorizeLfo3Shape[PARAMETER_ARRAY_LENGTH];   // 3 shapes used
-	int matrixMixLfo1Shape[PARAMETER_ARRAY_LENGTH];        // 6 shapes used
-	int matrixMixLfo2Shape[PARAMETER_ARRAY_LENGTH];        // 3 shapes used
-	int finalMixAndKeyLfoShape[PARAMETER_ARRAY_LENGTH];    // 3 shapes used
+	int* const ch1AdjustLfoShape=groupShapes(GROUP_CH1_ADJUST_LFO); // 8 shapes used (indices 0-7)
+	int* const ch2MixAndKeyLfoShape=groupShapes(GROUP_CH2_MIX_AND_KEY_LFO); // 3 shapes used (indices 0-2)
+	int* const ch2AdjustLfoShape=groupShapes(GROUP_CH2_ADJUST_LFO); // 8 shapes used
+	int* const fb1MixAndKeyLfoShape=groupShapes(GROUP_FB1_MIX_AND_KEY_LFO); // 3 shapes used
+	int* const fb1Geo1Lfo1Shape=groupShapes(GROUP_FB1_GEO1_LFO1); // 4 shapes used
+	int* const fb1Geo1Lfo2Shape=groupShapes(GROUP_FB1_GEO1_LFO2); // 5 shapes used
+	int* const fb1Color1Lfo1Shape=groupShapes(GROUP_FB1_COLOR1_LFO1); // 3 shapes used
+	int* const block2InputAdjustLfoShape=groupShapes(GROUP_BLOCK2_INPUT_ADJUST_LFO); // 8 shapes used
+	int* const fb2MixAndKeyLfoShape=groupShapes(GROUP_FB2_MIX_AND_KEY_LFO); // 3 shapes used
+	int* const fb2Geo1Lfo1Shape=groupShapes(GROUP_FB2_GEO1_LFO1); // 4 shapes used
+	int* const fb2Geo1Lfo2Shape=groupShapes(GROUP_FB2_GEO1_LFO2); // 5 shapes used
+	int* const fb2Color1Lfo1Shape=groupShapes(GROUP_FB2_COLOR1_LFO1); // 3 shapes used
+	int* const block1Geo1Lfo1Shape=groupShapes(GROUP_BLOCK1_GEO1_LFO1); // 4 shapes used
+	int* const block1Geo1Lfo2Shape=groupShapes(GROUP_BLOCK1_GEO1_LFO2); // 5 shapes used
+	int* const block1ColorizeLfo1Shape=groupShapes(GROUP_BLOCK1_COLORIZE_LFO1); // 6 shapes used
+	int* const block1ColorizeLfo2Shape=groupShapes(GROUP_BLOCK1_COLORIZE_LFO2); // 6 shapes used
+	int* const block1ColorizeLfo3Shape=groupShapes(GROUP_BLOCK1_COLORIZE_LFO3); // 3 shapes used
+	int* const block1Color1Lfo1Shape=groupShapes(GROUP_BLOCK1_COLOR1_LFO1); // (legacy - may not be used)
+	int* const block2Geo1Lfo1Shape=groupShapes(GROUP_BLOCK2_GEO1_LFO1); // 4 shapes used
+	int* const block2Geo1Lfo2Shape=groupShapes(GROUP_BLOCK2_GEO1_LFO2); // 5 shapes used
+	int* const block2ColorizeLfo1Shape=groupShapes(GROUP_BLOCK2_COLORIZE_LFO1); // 6 shapes used
+	int* const block2ColorizeLfo2Shape=groupShapes(GROUP_BLOCK2_COLORIZE_LFO2); // 6 shapes used
+	int* const block2ColorizeLfo3Shape=groupShapes(GROUP_BLOCK2_COLORIZE_LFO3); // 3 shapes used
+	int* const matrixMixLfo1Shape=groupShapes(GROUP_MATRIX_MIX_LFO1); // 6 shapes used
+	int* const matrixMixLfo2Shape=groupShapes(GROUP_MATRIX_MIX_LFO2); // 3 shapes used
+	int* const finalMixAndKeyLfoShape=groupShapes(GROUP_FINAL_MIX_AND_KEY_LFO); // 3 shapes used
 
 	// ============== OSC PARAMETER REGISTRY ==============
 	// Registry of all OSC-controllable parameters
@@ -2178,15 +1346,8 @@ public:
 	// Flag to pause receiving during sendAll
 	std::atomic<bool> oscReceivePaused{false};
 
-	// Initialize the OSC parameter registry (call in setup)
-	void registerBlock1OscParameters();
-	void registerBlock2OscParameters();
-	void registerBlock3OscParameters();
-
-	// Helper to add a parameter to the registry
-	void registerOscParam(const std::string& address, float* ptr);
-	void registerOscParam(const std::string& address, bool* ptr);
-	void registerOscParam(const std::string& address, int* ptr);
+	// Rebuild the OSC parameter registry from the parameter schema (call in setup)
+	void registerOscParameters();
 
 	// Video/OSC Settings save/load
 	void saveVideoOscSettings();
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// Compact MIDI event, small enough to travel through the ring as part of
+// a single 64 bit atomic word.
+struct MidiEvent {
+	uint8_t status = 0;   // MidiStatus without the channel nibble
+	uint8_t channel = 0;  // 1-16, 0 for system messages
+	uint8_t data1 = 0;    // control / pitch
+	uint8_t data2 = 0;    // value / velocity
+};
+
+// Single producer / single consumer ring for MIDI events.
+// The RtMidi callback pushes, the control loop drains once per frame.
+// The producer never blocks and never allocates: when the consumer falls
+// behind, the oldest slots are overwritten. Each slot stores the low 32
+// bits of its write index next to the event, so the consumer can tell an
+// overwritten slot apart from the one it expected and count it as dropped.
+template<unsigned int CAPACITY>
+class MidiEventRing {
+	static_assert((CAPACITY & (CAPACITY - 1)) == 0, "capacity must be a power of two");
+
+public:
+	MidiEventRing() {
+		for (unsigned int i = 0; i < CAPACITY; i++) {
+			// Index that can never match a live write
+			slots[i].store(pack(MidiEvent(), (uint32_t)(i + 1)), std::memory_order_relaxed);
+		}
+	}
+
+	// Producer side (MIDI callback thread)
+	void push(const MidiEvent& event) {
+		uint64_t index = head.load(std::memory_order_relaxed);
+		slots[index & (CAPACITY - 1)].store(pack(event, (uint32_t)index), std::memory_order_release);
+		head.store(index + 1, std::memory_order_release);
+	}
+
+	// Consumer side (main thread). Calls handler for every event still in
+	// the ring, oldest first, and returns the number of events handled.
+	template<typename Handler>
+	unsigned int drain(Handler handler) {
+		uint64_t end = head.load(std::memory_order_acquire);
+		unsigned int handled = 0;
+
+		if (end - tail > CAPACITY) {
+			dropped += end - tail - CAPACITY;
+			tail = end - CAPACITY;
+		}
+
+		while (tail < end) {
+			uint64_t word = slots[tail & (CAPACITY - 1)].load(std::memory_order_acquire);
+			if ((uint32_t)(word >> 32) == (uint32_t)tail) {
+				handler(unpack(word));
+				handled++;
+			} else {
+				// Producer lapped us while we were reading
+				dropped++;
+			}
+			tail++;
+		}
+		return handled;
+	}
+
+	uint64_t getDroppedCount() const { return dropped; }
+	void resetDroppedCount() { dropped = 0; }
+
+private:
+	static uint64_t pack(const MidiEvent& event, uint32_t index) {
+		uint32_t payload = (uint32_t)event.status
+			| ((uint32_t)event.channel << 8)
+			| ((uint32_t)event.data1 << 16)
+			| ((uint32_t)event.data2 << 24);
+		return ((uint64_t)index << 32) | payload;
+	}
+
+	static MidiEvent unpack(uint64_t word) {
+		MidiEvent event;
+		event.status = (uint8_t)(word & 0xFF);
+		event.channel = (uint8_t)((word >> 8) & 0xFF);
+		event.data1 = (uint8_t)((word >> 16) & 0xFF);
+		event.data2 = (uint8_t)((word >> 24) & 0xFF);
+		return event;
+	}
+
+	std::atomic<uint64_t> slots[CAPACITY];
+	std::atomic<uint64_t> head{0};
+
+	// Consumer-owned
+	uint64_t tail = 0;
+	uint64_t dropped = 0;
+};
@@ -0,0 +1,249 @@
+#include "MidiRouter.h"
+#include "GuiApp.h"
+
+//--------------------------------------------------------------
+MidiRouter::MidiRouter() {
+	for (int ch = 0; ch < 16; ch++) {
+		nrpnNumber[ch] = -1;
+		nrpnParamMsb[ch] = 0;
+		nrpnDataMsb[ch] = 0;
+		for (int cc = 0; cc < 32; cc++) ccMsb[ch][cc] = 0;
+	}
+	rebuild();
+}
+
+//--------------------------------------------------------------
+const char* MidiRouter::typeName(RouteType type) {
+	switch (type) {
+		case RouteType::CC: return "cc";
+		case RouteType::CC14: return "cc14";
+		case RouteType::NRPN: return "nrpn";
+	}
+	return "cc";
+}
+
+//--------------------------------------------------------------
+void MidiRouter::rebuild() {
+	for (int ch = 0; ch < 16; ch++) {
+		for (int cc = 0; cc < 128; cc++) ccTable[ch][cc] = -1;
+	}
+	nrpnTable.clear();
+
+	for (int i = 0; i < (int)routes.size(); i++) {
+		const Route& r = routes[i];
+		if (r.channel < 0 || r.channel > 15) continue;
+		if (r.type == RouteType::NRPN) {
+			nrpnTable[nrpnKey(r.channel, r.number)] = i;
+		} else if (r.number >= 0 && r.number < 128) {
+			ccTable[r.channel][r.number] = i;
+		}
+	}
+}
+
+//--------------------------------------------------------------
+void MidiRouter::addRoute(const Route& route) {
+	// One route per controller; a new assignment replaces the old one
+	for (int i = 0; i < (int)routes.size(); i++) {
+		if (routes[i].channel == route.channel && routes[i].number == route.number
+			&& (routes[i].type == RouteType::NRPN) == (route.type == RouteType::NRPN)) {
+			routes[i] = route;
+			rebuild();
+			return;
+		}
+	}
+	routes.push_back(route);
+	rebuild();
+}
+
+//--------------------------------------------------------------
+void MidiRouter::removeRoute(int index) {
+	if (index < 0 || index >= (int)routes.size()) return;
+	routes.erase(routes.begin() + index);
+	lastLearnedRoute = -1;
+	rebuild();
+}
+
+//--------------------------------------------------------------
+void MidiRouter::clear() {
+	routes.clear();
+	lastLearnedRoute = -1;
+	rebuild();
+}
+
+//--------------------------------------------------------------
+MidiRouter::Route* MidiRouter::getRoute(int index) {
+	if (index < 0 || index >= (int)routes.size()) return nullptr;
+	return &routes[index];
+}
+
+//--------------------------------------------------------------
+void MidiRouter::startLearn(OscParameter* target) {
+	learnTarget = target;
+}
+
+//--------------------------------------------------------------
+void MidiRouter::cancelLearn() {
+	learnTarget = nullptr;
+}
+
+//--------------------------------------------------------------
+void MidiRouter::learn(RouteType type, int channel, int number) {
+	Route route;
+	route.type = type;
+	route.channel = channel;
+	route.number = number;
+	route.target = learnTarget;
+
+	// Map the controller over the parameter's range from the schema
+	route.offset = learnTarget->minValue;
+	route.scale = learnTarget->maxValue - learnTarget->minValue;
+
+	addRoute(route);
+	for (int i = 0; i < (int)routes.size(); i++) {
+		if (routes[i].target == learnTarget && routes[i].channel == channel && routes[i].number == number) {
+			lastLearnedRoute = i;
+		}
+	}
+
+	ofLogNotice("MIDI") << "Learned " << typeName(type) << " " << number << " on channel " << (channel + 1)
+		<< " -> " << learnTarget->address;
+	learnTarget = nullptr;
+}
+
+//--------------------------------------------------------------
+void MidiRouter::apply(int routeIndex, float normalized) {
+	const Route& r = routes[routeIndex];
+	if (r.target) r.target->setValueFromFloat(r.offset + normalized * r.scale);
+}
+
+//--------------------------------------------------------------
+void MidiRouter::handle(const MidiEvent& event) {
+	if (event.status != MIDI_CONTROL_CHANGE) return;
+	if (event.channel < 1 || event.channel > 16) return;
+	handleControlChange(event.channel - 1, event.data1 & 0x7F, event.data2 & 0x7F);
+}
+
+//--------------------------------------------------------------
+void MidiRouter::handleControlChange(int ch, int cc, int value) {
+	// The 14 bit upgrade window closes as soon as any other controller moves
+	if (lastLearnedRoute >= 0) {
+		const Route& learned = routes[lastLearnedRoute];
+		if (learned.type != RouteType::CC || learned.channel != ch
+			|| (cc != learned.number && cc != learned.number + 32)) {
+			lastLearnedRoute = -1;
+		}
+	}
+
+	// NRPN parameter select
+	if (cc == 99) {
+		nrpnParamMsb[ch] = value;
+		nrpnNumber[ch] = -1;
+		return;
+	}
+	if (cc == 98) {
+		nrpnNumber[ch] = (nrpnParamMsb[ch] << 7) | value;
+		return;
+	}
+	// RPN select or RPN/NRPN null ends the current NRPN
+	if (cc == 101 || cc == 100) {
+		nrpnNumber[ch] = -1;
+		return;
+	}
+
+	// NRPN data entry
+	if ((cc == 6 || cc == 38) && nrpnNumber[ch] >= 0) {
+		int data;
+		if (cc == 6) {
+			nrpnDataMsb[ch] = value;
+			data = value << 7;
+		} else {
+			data = (nrpnDataMsb[ch] << 7) | value;
+		}
+
+		if (learnTarget) {
+			learn(RouteType::NRPN, ch, nrpnNumber[ch]);
+		}
+		auto it = nrpnTable.find(nrpnKey(ch, nrpnNumber[ch]));
+		if (it != nrpnTable.end()) apply(it->second, data / 16383.0f);
+		return;
+	}
+
+	// 14 bit LSB half for a mapped MSB controller
+	if (cc >= 32 && cc < 64) {
+		int msbIndex = ccTable[ch][cc - 32];
+		if (learnTarget == nullptr && msbIndex >= 0 && msbIndex == lastLearnedRoute
+			&& routes[msbIndex].type == RouteType::CC) {
+			// Controller sent an LSB right after being learned: it is a 14 bit fader
+			routes[msbIndex].type = RouteType::CC14;
+			ofLogNotice("MIDI") << "cc " << (cc - 32) << " on channel " << (ch + 1) << " upgraded to 14 bit";
+		}
+		if (msbIndex >= 0 && routes[msbIndex].type == RouteType::CC14) {
+			apply(msbIndex, ((ccMsb[ch][cc - 32] << 7) | value) / 16383.0f);
+			return;
+		}
+	}
+
+	if (learnTarget) {
+		learn(RouteType::CC, ch, cc);
+	}
+
+	if (cc < 32) ccMsb[ch][cc] = value;
+
+	int index = ccTable[ch][cc];
+	if (index < 0) return;
+
+	if (routes[index].type == RouteType::CC14) {
+		apply(index, (value << 7) / 16383.0f);
+	} else {
+		apply(index, value / 127.0f);
+	}
+}
+
+//--------------------------------------------------------------
+ofJson MidiRouter::toJson() const {
+	ofJson json = ofJson::array();
+	for (const auto& r : routes) {
+		if (!r.target) continue;
+		ofJson entry;
+		entry["type"] = typeName(r.type);
+		entry["channel"] = r.channel + 1;
+		entry["number"] = r.number;
+		entry["address"] = r.target->address;
+		entry["scale"] = r.scale;
+		entry["offset"] = r.offset;
+		json.push_back(entry);
+	}
+	return json;
+}
+
+//--------------------------------------------------------------
+void MidiRouter::fromJson(const ofJson& json, const std::map<std::string, OscParameter*>& addressMap) {
+	routes.clear();
+	lastLearnedRoute = -1;
+
+	if (json.is_array()) {
+		for (const auto& entry : json) {
+			std::string address = entry.value("address", "");
+			auto it = addressMap.find(address);
+			if (it == addressMap.end()) {
+				ofLogWarning("MIDI") << "Skipping route to unknown parameter " << address;
+				continue;
+			}
+
+			Route r;
+			std::string type = entry.value("type", "cc");
+			if (type == "cc14") r.type = RouteType::CC14;
+			else if (type == "nrpn") r.type = RouteType::NRPN;
+			else r.type = RouteType::CC;
+			r.channel = ofClamp(entry.value("channel", 1), 1, 16) - 1;
+			r.number = entry.value("number", 0);
+			r.target = it->second;
+			r.scale = entry.value("scale", 2.0f);
+			r.offset = entry.value("offset", -1.0f);
+			routes.push_back(r);
+		}
+	}
+
+	rebuild();
+	ofLogNotice("MIDI") << "Loaded " << routes.size() << " MIDI route(s)";
+}
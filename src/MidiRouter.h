@@ -0,0 +1,74 @@
+#pragma once
+
+#include "ofMain.h"
+#include "MidiEventRing.h"
+#include <unordered_map>
+
+struct OscParameter;
+
+// Direct MIDI -> parameter routing.
+// Routes are kept in a list (for the GUI and settings.json) and flattened
+// into lookup tables indexed by [channel][cc] and by NRPN number, so an
+// incoming controller costs one table read no matter how many are mapped.
+// A normalized controller value n (0..1) is written as offset + n * scale.
+class MidiRouter {
+public:
+	enum class RouteType {
+		CC,      // 7 bit control change
+		CC14,    // 14 bit pair, MSB on cc 0-31 and LSB on cc+32
+		NRPN     // 14 bit NRPN via cc 99/98 + data entry 6/38
+	};
+
+	struct Route {
+		RouteType type = RouteType::CC;
+		int channel = 0;    // 0-15
+		int number = 0;     // cc number, or NRPN parameter number
+		OscParameter* target = nullptr;
+		float scale = 2.0f;
+		float offset = -1.0f;
+	};
+
+	MidiRouter();
+
+	// Called from the control loop for every drained event
+	void handle(const MidiEvent& event);
+
+	void addRoute(const Route& route);
+	void removeRoute(int index);
+	void clear();
+	const std::vector<Route>& getRoutes() const { return routes; }
+	Route* getRoute(int index);
+
+	// Learn mode binds the next controller that moves to target
+	void startLearn(OscParameter* target);
+	void cancelLearn();
+	bool isLearning() const { return learnTarget != nullptr; }
+	OscParameter* getLearnTarget() const { return learnTarget; }
+
+	ofJson toJson() const;
+	void fromJson(const ofJson& json, const std::map<std::string, OscParameter*>& addressMap);
+
+	static const char* typeName(RouteType type);
+
+private:
+	void rebuild();
+	void apply(int routeIndex, float normalized);
+	void learn(RouteType type, int channel, int number);
+	void handleControlChange(int channel, int cc, int value);
+	static uint32_t nrpnKey(int channel, int number) { return ((uint32_t)channel << 14) | (uint32_t)number; }
+
+	std::vector<Route> routes;
+
+	// Route index per [channel][cc], -1 when unmapped
+	int ccTable[16][128];
+	std::unordered_map<uint32_t, int> nrpnTable;
+
+	// 14 bit assembly state
+	uint8_t ccMsb[16][32];
+	int nrpnNumber[16];    // -1 when no NRPN is selected
+	uint8_t nrpnParamMsb[16];
+	uint8_t nrpnDataMsb[16];
+
+	OscParameter* learnTarget = nullptr;
+	int lastLearnedRoute = -1;
+};
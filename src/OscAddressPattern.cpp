@@ -0,0 +1,173 @@
+#include "OscAddressPattern.h"
+#include <cstring>
+#include <algorithm>
+
+//--------------------------------------------------------------
+bool OscAddressPattern::isPattern(const std::string& address) {
+    return address.find_first_of("*?[]{}") != std::string::npos;
+}
+
+//--------------------------------------------------------------
+bool OscAddressPattern::compile(const std::string& pattern) {
+    parts.clear();
+    valid = false;
+
+    if (pattern.empty() || pattern[0] != '/') return false;
+
+    size_t start = 1;
+    while (start <= pattern.size()) {
+        size_t end = pattern.find('/', start);
+        if (end == std::string::npos) end = pattern.size();
+
+        Part part;
+        if (!compilePart(pattern.substr(start, end - start), part)) {
+            parts.clear();
+            return false;
+        }
+        parts.push_back(part);
+        start = end + 1;
+    }
+
+    valid = true;
+    return true;
+}
+
+//--------------------------------------------------------------
+bool OscAddressPattern::compilePart(const std::string& text, Part& part) {
+    size_t i = 0;
+    while (i < text.size()) {
+        char c = text[i];
+        Token token;
+
+        if (c == '*') {
+            token.type = TokenType::ANY_SEQUENCE;
+            // Consecutive stars collapse into one
+            while (i < text.size() && text[i] == '*') i++;
+        }
+        else if (c == '?') {
+            token.type = TokenType::ANY_CHAR;
+            i++;
+        }
+        else if (c == '[') {
+            size_t close = text.find(']', i + 1);
+            if (close == std::string::npos) return false;
+
+            token.type = TokenType::CHAR_SET;
+            size_t j = i + 1;
+            bool negate = false;
+            if (j < close && text[j] == '!') {
+                negate = true;
+                j++;
+            }
+            while (j < close) {
+                unsigned char lo = text[j];
+                // '-' is a range only when it sits between two characters
+                if (j + 2 < close && text[j + 1] == '-') {
+                    unsigned char hi = text[j + 2];
+                    if (hi < lo) std::swap(lo, hi);
+                    for (int k = lo; k <= hi; k++) token.charSet.set(k);
+                    j += 3;
+                } else {
+                    token.charSet.set(lo);
+                    j++;
+                }
+            }
+            if (negate) token.charSet.flip();
+            i = close + 1;
+        }
+        else if (c == '{') {
+            size_t close = text.find('}', i + 1);
+            if (close == std::string::npos) return false;
+
+            token.type = TokenType::ALTERNATIVES;
+            size_t j = i + 1;
+            while (j <= close) {
+                size_t comma = text.find(',', j);
+                if (comma == std::string::npos || comma > close) comma = close;
+                token.alternatives.push_back(text.substr(j, comma - j));
+                j = comma + 1;
+            }
+            i = close + 1;
+        }
+        else if (c == ']' || c == '}') {
+            return false;
+        }
+        else {
+            token.type = TokenType::LITERAL;
+            size_t next = text.find_first_of("*?[]{}", i);
+            if (next == std::string::npos) next = text.size();
+            token.literal = text.substr(i, next - i);
+            i = next;
+        }
+
+        part.push_back(token);
+    }
+    return true;
+}
+
+//--------------------------------------------------------------
+bool OscAddressPattern::matches(const std::string& address) const {
+    if (!valid || address.empty() || address[0] != '/') return false;
+
+    const char* str = address.c_str();
+    size_t start = 1;
+    size_t partIndex = 0;
+
+    while (start <= address.size()) {
+        if (partIndex >= parts.size()) return false;
+
+        size_t end = address.find('/', start);
+        if (end == std::string::npos) end = address.size();
+
+        if (!matchPart(parts[partIndex], 0, str + start, end - start, 0)) return false;
+
+        partIndex++;
+        start = end + 1;
+    }
+
+    return partIndex == parts.size();
+}
+
+//--------------------------------------------------------------
+bool OscAddressPattern::matchPart(const Part& part, size_t tokenIndex,
+                                  const char* str, size_t length, size_t pos) const {
+    while (tokenIndex < part.size()) {
+        const Token& token = part[tokenIndex];
+
+        switch (token.type) {
+            case TokenType::LITERAL: {
+                size_t n = token.literal.size();
+                if (pos + n > length) return false;
+                if (std::memcmp(str + pos, token.literal.data(), n) != 0) return false;
+                pos += n;
+                break;
+            }
+            case TokenType::ANY_CHAR:
+                if (pos >= length) return false;
+                pos++;
+                break;
+            case TokenType::CHAR_SET:
+                if (pos >= length) return false;
+                if (!token.charSet.test(static_cast<unsigned char>(str[pos]))) return false;
+                pos++;
+                break;
+            case TokenType::ANY_SEQUENCE:
+                // Trailing star swallows the rest of the part
+                if (tokenIndex + 1 == part.size()) return true;
+                for (size_t p = pos; p <= length; p++) {
+                    if (matchPart(part, tokenIndex + 1, str, length, p)) return true;
+                }
+                return false;
+            case TokenType::ALTERNATIVES:
+                for (const auto& alt : token.alternatives) {
+                    size_t n = alt.size();
+                    if (pos + n > length) continue;
+                    if (std::memcmp(str + pos, alt.data(), n) != 0) continue;
+                    if (matchPart(part, tokenIndex + 1, str, length, pos + n)) return true;
+                }
+                return false;
+        }
+        tokenIndex++;
+    }
+    return pos == length;
+}
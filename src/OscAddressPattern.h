@@ -0,0 +1,48 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <bitset>
+
+// OSC 1.0 address pattern matcher.
+// A pattern is compiled once into per-part token lists and can then be
+// matched against any number of addresses without re-parsing.
+// Supported: '*', '?', '[abc]', '[a-z]', '[!abc]' and '{foo,bar}'.
+// Wildcards never cross a '/' so parts are matched independently.
+class OscAddressPattern {
+public:
+    OscAddressPattern() {}
+    explicit OscAddressPattern(const std::string& pattern) { compile(pattern); }
+
+    bool compile(const std::string& pattern);
+    bool matches(const std::string& address) const;
+    bool isValid() const { return valid; }
+
+    // True if the address contains any OSC pattern characters
+    static bool isPattern(const std::string& address);
+
+private:
+    enum class TokenType {
+        LITERAL,
+        ANY_CHAR,
+        ANY_SEQUENCE,
+        CHAR_SET,
+        ALTERNATIVES
+    };
+
+    struct Token {
+        TokenType type;
+        std::string literal;
+        std::bitset<256> charSet;
+        std::vector<std::string> alternatives;
+    };
+
+    typedef std::vector<Token> Part;
+
+    bool compilePart(const std::string& text, Part& part);
+    bool matchPart(const Part& part, size_t tokenIndex,
+                   const char* str, size_t length, size_t pos) const;
+
+    std::vector<Part> parts;
+    bool valid = false;
+};
@@ -0,0 +1,79 @@
+#include "OscBundleReceiver.h"
+#include <chrono>
+
+//--------------------------------------------------------------
+bool OscBundleReceiver::getNextTimedMessage(TimedMessage& timed) {
+    std::lock_guard<std::mutex> lock(timedMutex);
+    if (timedMessages.empty()) return false;
+    timed = std::move(timedMessages.front());
+    timedMessages.pop_front();
+    return true;
+}
+
+//--------------------------------------------------------------
+void OscBundleReceiver::clearTimedMessages() {
+    std::lock_guard<std::mutex> lock(timedMutex);
+    timedMessages.clear();
+}
+
+//--------------------------------------------------------------
+double OscBundleReceiver::timeTagToSeconds(uint64_t timeTag) {
+    // NTP epoch is 1900-01-01, 70 years before the unix epoch
+    const double ntpToUnix = 2208988800.0;
+    double seconds = static_cast<double>(timeTag >> 32);
+    double fraction = static_cast<double>(timeTag & 0xFFFFFFFFull) / 4294967296.0;
+    return seconds - ntpToUnix + fraction;
+}
+
+//--------------------------------------------------------------
+double OscBundleReceiver::nowSeconds() {
+    using namespace std::chrono;
+    return duration_cast<duration<double>>(system_clock::now().time_since_epoch()).count();
+}
+
+//--------------------------------------------------------------
+void OscBundleReceiver::ProcessBundle(const osc::ReceivedBundle& b, const osc::IpEndpointName& remoteEndpoint) {
+    // Nested bundles carry their own tag; restore the outer one afterwards
+    uint64_t outerTimeTag = currentTimeTag;
+    currentTimeTag = b.TimeTag();
+    osc::OscPacketListener::ProcessBundle(b, remoteEndpoint);
+    currentTimeTag = outerTimeTag;
+}
+
+//--------------------------------------------------------------
+void OscBundleReceiver::ProcessMessage(const osc::ReceivedMessage& m, const osc::IpEndpointName& remoteEndpoint) {
+    if (currentTimeTag == IMMEDIATE) {
+        ofxOscReceiver::ProcessMessage(m, remoteEndpoint);
+        return;
+    }
+
+    TimedMessage timed;
+    timed.timeTag = currentTimeTag;
+    ofxOscMessage& msg = timed.message;
+
+    msg.setAddress(m.AddressPattern());
+
+    char endpointHost[osc::IpEndpointName::ADDRESS_STRING_LENGTH];
+    remoteEndpoint.AddressAsString(endpointHost);
+    msg.setRemoteEndpoint(endpointHost, remoteEndpoint.port);
+
+    for (osc::ReceivedMessage::const_iterator arg = m.ArgumentsBegin(); arg != m.ArgumentsEnd(); ++arg) {
+        if (arg->IsInt32()) msg.addIntArg(arg->AsInt32Unchecked());
+        else if (arg->IsInt64()) msg.addInt64Arg(arg->AsInt64Unchecked());
+        else if (arg->IsFloat()) msg.addFloatArg(arg->AsFloatUnchecked());
+        else if (arg->IsDouble()) msg.addDoubleArg(arg->AsDoubleUnchecked());
+        else if (arg->IsString()) msg.addStringArg(arg->AsStringUnchecked());
+        else if (arg->IsSymbol()) msg.addSymbolArg(arg->AsSymbolUnchecked());
+        else if (arg->IsChar()) msg.addCharArg(arg->AsCharUnchecked());
+        else if (arg->IsBool()) msg.addBoolArg(arg->AsBoolUnchecked());
+        else if (arg->IsNil()) msg.addTriggerArg();
+        else if (arg->IsInfinitum()) msg.addImpulseArg();
+        else if (arg->IsTimeTag()) msg.addTimetagArg(arg->AsTimeTagUnchecked());
+        else {
+            ofLogVerbose("OSC") << "Unhandled argument type in bundle message " << m.AddressPattern();
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(timedMutex);
+    timedMessages.push_back(std::move(timed));
+}
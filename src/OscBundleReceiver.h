@@ -0,0 +1,40 @@
+#pragma once
+
+#include "ofxOsc.h"
+#include <deque>
+#include <mutex>
+
+// ofxOscReceiver drops bundle timetags and delivers bundle contents as
+// plain messages. This receiver keeps messages from timetagged bundles
+// aside, together with their tag, so they can be scheduled instead of
+// being applied on arrival. Immediate messages and bundles tagged
+// "now" (timetag 1) still go through the regular message queue.
+class OscBundleReceiver : public ofxOscReceiver {
+public:
+    struct TimedMessage {
+        uint64_t timeTag = 1;
+        ofxOscMessage message;
+    };
+
+    bool getNextTimedMessage(TimedMessage& timed);
+    // Drops everything still waiting, e.g. once the receiver is rebound
+    void clearTimedMessages();
+
+    // NTP timetag (seconds since 1900) to seconds since the unix epoch
+    static double timeTagToSeconds(uint64_t timeTag);
+    // Current wall clock in the same seconds-since-epoch base
+    static double nowSeconds();
+
+    static const uint64_t IMMEDIATE = 1;
+
+protected:
+    void ProcessBundle(const osc::ReceivedBundle& b, const osc::IpEndpointName& remoteEndpoint) override;
+    void ProcessMessage(const osc::ReceivedMessage& m, const osc::IpEndpointName& remoteEndpoint) override;
+
+private:
+    // Only touched from the listener thread
+    uint64_t currentTimeTag = IMMEDIATE;
+
+    std::mutex timedMutex;
+    std::deque<TimedMessage> timedMessages;
+};
@@ -0,0 +1,110 @@
+#include "ParameterMorph.h"
+
+const char* ParameterMorph::curveNames[CURVE_COUNT] = { "linear", "smooth", "ease in", "ease out" };
+
+//--------------------------------------------------------------
+void ParameterMorph::start(const ParameterSchema& schema, const std::vector<float>& target,
+	float durationMs, int morphCurve, float morphSwitchPoint) {
+	running = false;
+	const std::vector<PresetField>& fields = schema.getFields();
+	if (target.size() != fields.size()) {
+		ofLogWarning("Morph") << "Target has " << target.size() << " values, expected " << fields.size();
+		return;
+	}
+
+	const std::vector<ParamGroup>& groups = schema.getGroups();
+	const std::vector<ParamDef>& params = schema.getParams();
+	runs.clear();
+	singles.clear();
+	discrete.clear();
+	from.clear();
+	delta.clear();
+
+	// Group slots first, so from / delta line up with the runs
+	for (size_t f = 0; f < fields.size(); f++) {
+		const PresetField& field = fields[f];
+		if (field.group < 0) continue;
+		const ParamGroup& group = groups[field.group];
+		if (field.shape) {
+			discrete.emplace_back(OscParameter("", &group.shapes[field.index]), target[f]);
+			continue;
+		}
+		float* value = group.values + field.index;
+		if (!runs.empty() && runs.back().values + runs.back().length == value) {
+			runs.back().length++;
+		} else {
+			runs.push_back({ value, (int)from.size(), 1 });
+		}
+		from.push_back(*value);
+		delta.push_back(target[f] - *value);
+	}
+
+	singlesOffset = (int)from.size();
+	for (size_t f = 0; f < fields.size(); f++) {
+		const PresetField& field = fields[f];
+		if (field.group >= 0 || std::isnan(target[f])) continue;
+		const OscParameter& handle = params[field.param].handle;
+		if (handle.type == OscParamType::FLOAT) {
+			singles.push_back(handle.floatPtr);
+			from.push_back(*handle.floatPtr);
+			delta.push_back(target[f] - *handle.floatPtr);
+		} else {
+			discrete.emplace_back(handle, target[f]);
+		}
+	}
+
+	duration = std::max(durationMs, 0.0f) / 1000.0f;
+	curve = std::min(std::max(morphCurve, 0), CURVE_COUNT - 1);
+	switchPoint = ofClamp(morphSwitchPoint, 0.0f, 1.0f);
+	startTime = ofGetElapsedTimef();
+	progress = 0;
+	switched = false;
+	running = true;
+}
+
+//--------------------------------------------------------------
+float ParameterMorph::shape(int curve, float t) {
+	switch (curve) {
+		case CURVE_SMOOTH: return t * t * (3.0f - 2.0f * t);
+		case CURVE_EASE_IN: return t * t;
+		case CURVE_EASE_OUT: return 1.0f - (1.0f - t) * (1.0f - t);
+		default: return t;
+	}
+}
+
+//--------------------------------------------------------------
+int ParameterMorph::update() {
+	if (!running) return 0;
+
+	progress = duration > 0 ? ofClamp((ofGetElapsedTimef() - startTime) / duration, 0.0f, 1.0f) : 1.0f;
+	const float t = shape(curve, progress);
+	const float* a = from.data();
+	const float* d = delta.data();
+
+	for (const Run& run : runs) {
+		float* values = run.values;
+		const float* runFrom = a + run.offset;
+		const float* runDelta = d + run.offset;
+		for (int i = 0; i < run.length; i++) values[i] = runFrom[i] + runDelta[i] * t;
+	}
+	for (size_t i = 0; i < singles.size(); i++) {
+		*singles[i] = a[singlesOffset + i] + d[singlesOffset + i] * t;
+	}
+
+	int events = 0;
+	if (!switched && progress >= switchPoint) {
+		setDiscrete();
+		switched = true;
+		events |= EVENT_SWITCHED;
+	}
+	if (progress >= 1.0f) {
+		running = false;
+		events |= EVENT_FINISHED;
+	}
+	return events;
+}
+
+//--------------------------------------------------------------
+void ParameterMorph::setDiscrete() {
+	for (auto& value : discrete) value.first.setValueFromFloat(value.second);
+}
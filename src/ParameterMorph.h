@@ -0,0 +1,64 @@
+#pragma once
+
+#include "ParameterSchema.h"
+
+// Glides the parameter store from its current values to a preset over a
+// set time. Float values are interpolated every frame. Group slots are
+// walked as runs over the flat store, merged wherever the store is
+// contiguous, so a frame is one tight loop instead of a call per
+// parameter. Discrete values (mix types, switches, lfo shapes) cannot be
+// blended; they change once, when the morph passes its switch point.
+class ParameterMorph {
+public:
+	enum Curve {
+		CURVE_LINEAR,
+		CURVE_SMOOTH,       // slow start and end
+		CURVE_EASE_IN,
+		CURVE_EASE_OUT,
+		CURVE_COUNT
+	};
+	static const char* curveNames[CURVE_COUNT];
+
+	// What update() crossed this frame
+	enum Event {
+		EVENT_SWITCHED = 1 << 0,    // discrete values were set
+		EVENT_FINISHED = 1 << 1     // every value is at its target
+	};
+
+	// target is in ParameterSchema field order, NaN keeps the current value.
+	// switchPoint is the fraction of the time at which discrete values change.
+	void start(const ParameterSchema& schema, const std::vector<float>& target,
+		float durationMs, int curve, float switchPoint);
+	// Writes this frame's values, returns the events crossed
+	int update();
+	void stop() { running = false; }
+
+	bool isRunning() const { return running; }
+	float getProgress() const { return progress; }
+
+private:
+	// PARAMETER_ARRAY_LENGTH slices or longer, offset into from / delta
+	struct Run {
+		float* values;
+		int offset;
+		int length;
+	};
+
+	static float shape(int curve, float t);
+	void setDiscrete();
+
+	std::vector<Run> runs;
+	std::vector<float*> singles;        // float parameters outside groups, after the runs in from / delta
+	int singlesOffset = 0;
+	std::vector<float> from;
+	std::vector<float> delta;
+	std::vector<std::pair<OscParameter, float>> discrete;
+
+	bool running = false;
+	bool switched = false;
+	float startTime = 0;
+	float duration = 0;                 // seconds
+	int curve = CURVE_LINEAR;
+	float switchPoint = 0.5f;
+	float progress = 0;
+};
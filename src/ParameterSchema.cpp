@@ -0,0 +1,335 @@
+#include "ParameterSchema.h"
+
+//--------------------------------------------------------------
+uint32_t ParameterSchema::fieldId(const std::string& block, const std::string& key, const std::string& slot) {
+	// FNV-1a
+	uint32_t hash = 2166136261u;
+	std::string text = block + "/" + key + "/" + slot;
+	for (unsigned char c : text) {
+		hash ^= c;
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+//--------------------------------------------------------------
+void ParameterSchema::clear() {
+	params.clear();
+	groups.clear();
+	addressIndex.clear();
+	fields.clear();
+	fieldIndex.clear();
+	layoutHash = 0;
+}
+
+//--------------------------------------------------------------
+void ParameterSchema::begin(int newSection, const std::string& newBlock, const std::string& oscPrefix) {
+	section = newSection;
+	block = newBlock;
+	prefix = oscPrefix;
+}
+
+//--------------------------------------------------------------
+ParamDef& ParameterSchema::addParam(const std::string& name, const OscParameter& handle, const PresetSlot& slot) {
+	ParamDef def;
+	def.name = name;
+	def.handle = handle;
+	def.block = block;
+	def.slot = slot;
+	def.section = section;
+
+	if (addressIndex.count(handle.address)) {
+		ofLogWarning("Parameters") << "Duplicate address " << handle.address;
+	}
+	addressIndex[handle.address] = (int)params.size();
+	params.push_back(def);
+	return params.back();
+}
+
+//--------------------------------------------------------------
+ParamDef& ParameterSchema::add(const std::string& name, float* ptr, const PresetSlot& slot) {
+	return addParam(name, OscParameter(prefix + name, ptr), slot);
+}
+
+ParamDef& ParameterSchema::add(const std::string& name, bool* ptr, const PresetSlot& slot) {
+	return addParam(name, OscParameter(prefix + name, ptr), slot);
+}
+
+ParamDef& ParameterSchema::add(const std::string& name, int* ptr, const PresetSlot& slot) {
+	return addParam(name, OscParameter(prefix + name, ptr), slot);
+}
+
+//--------------------------------------------------------------
+ParamGroup& ParameterSchema::addGroup(const std::string& key, float* values, bool* midiActive,
+	std::initializer_list<const char*> names) {
+	int groupIndex = (int)groups.size();
+	ParamGroup group;
+	group.key = key;
+	group.block = block;
+	group.section = section;
+	group.values = values;
+	group.midiActive = midiActive;
+	groups.push_back(group);
+
+	int i = 0;
+	for (const char* name : names) {
+		addParam(name, OscParameter(prefix + name, &values[i]), PresetSlot()).group = groupIndex;
+		i++;
+	}
+	return groups.back();
+}
+
+//--------------------------------------------------------------
+ParamGroup& ParameterSchema::addLfoGroup(const std::string& key, float* values, bool* midiActive, int* shapes,
+	LfoLayout layout, const std::string& targetKey, std::initializer_list<const char*> names) {
+	int groupIndex = (int)groups.size();
+	ParamGroup group;
+	group.key = key;
+	group.block = block;
+	group.section = section;
+	group.values = values;
+	group.midiActive = midiActive;
+	group.shapes = shapes;
+	groups.push_back(group);
+
+	int targetGroup = findGroup(targetKey);
+	int i = 0;
+	for (const char* name : names) {
+		int ampSlot = layout == LfoLayout::INTERLEAVED ? 2 * i : (i / 3) * 6 + i % 3;
+		int rateSlot = layout == LfoLayout::INTERLEAVED ? 2 * i + 1 : ampSlot + 3;
+
+		int target = -1;
+		for (int p = 0; p < (int)params.size() && targetGroup >= 0; p++) {
+			if (params[p].group == targetGroup && params[p].name == name) {
+				target = p;
+				break;
+			}
+		}
+		if (target < 0) {
+			ofLogWarning("Parameters") << key << ": no lfo target " << name << " in " << targetKey;
+		}
+
+		std::string base = name;
+		ParamDef& amp = addParam(base + "Amp", OscParameter(prefix + base + "Amp", &values[ampSlot]), PresetSlot());
+		amp.group = groupIndex;
+		amp.lfoTarget = target;
+		ParamDef& rate = addParam(base + "Rate", OscParameter(prefix + base + "Rate", &values[rateSlot]), PresetSlot());
+		rate.group = groupIndex;
+		rate.lfoTarget = target;
+		ParamDef& shape = addParam(base + "Shape", OscParameter(prefix + base + "Shape", &shapes[i]), PresetSlot());
+		shape.group = groupIndex;
+		shape.lfoTarget = target;
+		shape.range(0.0f, LFO_SHAPE_COUNT - 1);
+		i++;
+	}
+	return groups.back();
+}
+
+//--------------------------------------------------------------
+void ParameterSchema::addLfo(const std::string& name, float* amp, float* rate, int* shape,
+	const std::string& key, const float* target) {
+	int targetIndex = -1;
+	for (int p = 0; p < (int)params.size(); p++) {
+		if (params[p].handle.type == OscParamType::FLOAT && params[p].handle.floatPtr == target) {
+			targetIndex = p;
+			break;
+		}
+	}
+
+	std::string ampName = name + "Amp";
+	std::string rateName = name + "Rate";
+	std::string shapeName = name + "Shape";
+	ParamDef& ampDef = add(ampName, amp, PresetSlot(key.c_str(), ampName.c_str())).resetTo(0.0f).range(0.0f, 1.0f);
+	ampDef.lfoTarget = targetIndex;
+	ParamDef& rateDef = add(rateName, rate, PresetSlot(key.c_str(), rateName.c_str())).resetTo(0.0f).range(0.0f, 1.0f);
+	rateDef.lfoTarget = targetIndex;
+	ParamDef& shapeDef = add(shapeName, shape, PresetSlot(key.c_str(), shapeName.c_str())).resetTo(0.0f).range(0.0f, LFO_SHAPE_COUNT - 1);
+	shapeDef.lfoTarget = targetIndex;
+}
+
+//--------------------------------------------------------------
+void ParameterSchema::addAlias(const std::string& address, const std::string& targetAddress) {
+	int target = findParam(targetAddress);
+	if (target < 0) {
+		ofLogWarning("Parameters") << "Alias " << address << " points at unknown " << targetAddress;
+		return;
+	}
+
+	// The alias only adds an address; saving and resetting stay with the original
+	ParamDef def = params[target];
+	def.handle.address = address;
+	def.slot = PresetSlot();
+	def.group = -1;
+	def.reset = ParamReset::NEVER;
+	addressIndex[address] = (int)params.size();
+	params.push_back(def);
+}
+
+//--------------------------------------------------------------
+int ParameterSchema::findParam(const std::string& address) const {
+	auto it = addressIndex.find(address);
+	return it != addressIndex.end() ? it->second : -1;
+}
+
+int ParameterSchema::findGroup(const std::string& key) const {
+	for (int g = 0; g < (int)groups.size(); g++) {
+		if (groups[g].key == key) return g;
+	}
+	return -1;
+}
+
+//--------------------------------------------------------------
+void ParameterSchema::finalize() {
+	fields.clear();
+	for (int g = 0; g < (int)groups.size(); g++) {
+		const ParamGroup& group = groups[g];
+		for (int i = 0; group.saveValues && i < PARAMETER_ARRAY_LENGTH; i++) {
+			PresetField field;
+			field.id = fieldId(group.block, group.key, ofToString(i));
+			field.group = g;
+			field.index = i;
+			fields.push_back(field);
+		}
+		for (int i = 0; group.shapes && i < PARAMETER_ARRAY_LENGTH; i++) {
+			PresetField field;
+			field.id = fieldId(group.block, group.key + "Shape", ofToString(i));
+			field.group = g;
+			field.index = i;
+			field.shape = true;
+			fields.push_back(field);
+		}
+	}
+
+	for (int p = 0; p < (int)params.size(); p++) {
+		const ParamDef& def = params[p];
+		if (def.group >= 0 || def.slot.key.empty()) continue;
+		PresetField field;
+		field.id = fieldId(def.block, def.slot.key, def.slot.index >= 0 ? ofToString(def.slot.index) : def.slot.field);
+		field.param = p;
+		fields.push_back(field);
+	}
+
+	fieldIndex.clear();
+	layoutHash = 2166136261u;
+	for (int f = 0; f < (int)fields.size(); f++) {
+		if (fieldIndex.count(fields[f].id)) {
+			ofLogWarning("Parameters") << "Preset field id collision at field " << f;
+		}
+		fieldIndex[fields[f].id] = f;
+		layoutHash = (layoutHash ^ fields[f].id) * 16777619u;
+	}
+}
+
+//--------------------------------------------------------------
+int ParameterSchema::findField(uint32_t id) const {
+	auto it = fieldIndex.find(id);
+	return it != fieldIndex.end() ? it->second : -1;
+}
+
+//--------------------------------------------------------------
+void ParameterSchema::defaults(std::vector<float>& values) const {
+	values.resize(fields.size());
+	for (size_t f = 0; f < fields.size(); f++) {
+		if (fields[f].group >= 0) {
+			values[f] = 0.0f;
+			continue;
+		}
+		const ParamDef& def = params[fields[f].param];
+		values[f] = def.reset != ParamReset::NEVER ? def.defaultValue : std::numeric_limits<float>::quiet_NaN();
+	}
+}
+
+//--------------------------------------------------------------
+void ParameterSchema::capture(std::vector<float>& values) const {
+	values.resize(fields.size());
+	for (size_t f = 0; f < fields.size(); f++) {
+		const PresetField& field = fields[f];
+		if (field.group >= 0) {
+			const ParamGroup& group = groups[field.group];
+			values[f] = field.shape ? (float)group.shapes[field.index] : group.values[field.index];
+		} else {
+			values[f] = params[field.param].handle.getValueAsFloat();
+		}
+	}
+}
+
+//--------------------------------------------------------------
+void ParameterSchema::write(const std::vector<float>& values, ofJson& json) const {
+	if (values.size() != fields.size()) return;
+
+	for (size_t f = 0; f < fields.size(); f++) {
+		const PresetField& field = fields[f];
+		if (field.group >= 0) {
+			const ParamGroup& group = groups[field.group];
+			ofJson& list = json[group.block][field.shape ? group.key + "Shape" : group.key];
+			if (field.shape) list[field.index] = (int)values[f];
+			else list[field.index] = values[f];
+			continue;
+		}
+
+		// NaN only comes from presets that never had the value; leave it out
+		if (std::isnan(values[f])) continue;
+		const ParamDef& def = params[field.param];
+		ofJson& entry = json[def.block][def.slot.key];
+		ofJson& slot = def.slot.index >= 0 ? entry[def.slot.index] : entry[def.slot.field];
+		switch (def.handle.type) {
+			case OscParamType::FLOAT: slot = values[f]; break;
+			case OscParamType::BOOL: slot = values[f] > 0.5f; break;
+			case OscParamType::INT: slot = (int)values[f]; break;
+		}
+	}
+}
+
+//--------------------------------------------------------------
+void ParameterSchema::apply(const std::vector<float>& values) {
+	if (values.size() != fields.size()) {
+		ofLogWarning("Parameters") << "Preset has " << values.size() << " values, expected " << fields.size();
+		return;
+	}
+
+	size_t f = 0;
+	while (f < fields.size()) {
+		const PresetField& field = fields[f];
+		if (field.group >= 0) {
+			// Whole group arrays are contiguous in both the layout and the store
+			const ParamGroup& group = groups[field.group];
+			if (field.shape) {
+				for (int i = 0; i < PARAMETER_ARRAY_LENGTH; i++) group.shapes[i] = (int)values[f + i];
+			} else {
+				std::copy(values.begin() + f, values.begin() + f + PARAMETER_ARRAY_LENGTH, group.values);
+			}
+			f += PARAMETER_ARRAY_LENGTH;
+			continue;
+		}
+		if (!std::isnan(values[f])) params[field.param].handle.setValueFromFloat(values[f]);
+		f++;
+	}
+}
+
+//--------------------------------------------------------------
+void ParameterSchema::reset(int sections, bool full) {
+	for (const ParamGroup& group : groups) {
+		if (!(group.section & sections)) continue;
+		std::fill(group.values, group.values + PARAMETER_ARRAY_LENGTH, 0.0f);
+		std::fill(group.midiActive, group.midiActive + PARAMETER_ARRAY_LENGTH, false);
+		// Shapes are a setup choice, only a full reset puts them back to sine
+		if (full && group.shapes) std::fill(group.shapes, group.shapes + PARAMETER_ARRAY_LENGTH, 0);
+	}
+
+	for (ParamDef& def : params) {
+		if (def.group >= 0 || !(def.section & sections)) continue;
+		if (def.reset == ParamReset::SECTION || (full && def.reset == ParamReset::FULL)) {
+			def.handle.setValueFromFloat(def.defaultValue);
+		}
+	}
+}
+
+//--------------------------------------------------------------
+void ParameterSchema::randomize(int sections, float amount) {
+	for (const ParamGroup& group : groups) {
+		if (!(group.section & sections) || !group.saveValues) continue;
+		for (int i = 0; i < PARAMETER_ARRAY_LENGTH; i++) {
+			group.values[i] += amount * ofRandomf() * ofRandomf();
+		}
+	}
+}
@@ -0,0 +1,215 @@
+#pragma once
+
+#include "ofMain.h"
+#include <initializer_list>
+#include <unordered_map>
+
+#define PARAMETER_ARRAY_LENGTH 16
+#define LFO_SHAPE_COUNT 5   // sine, triangle, ramp, saw, square
+
+// OSC Parameter types
+enum class OscParamType {
+	FLOAT,
+	BOOL,
+	INT
+};
+
+// Struct to bind a parameter to its OSC address
+struct OscParameter {
+	std::string address;
+	OscParamType type;
+	union {
+		float* floatPtr;
+		bool* boolPtr;
+		int* intPtr;
+	};
+
+	// Value range used when mapping normalized controllers (MIDI learn)
+	float minValue = -1.0f;
+	float maxValue = 1.0f;
+
+	// Constructors for each type
+	OscParameter(const std::string& addr, float* ptr)
+		: address(addr), type(OscParamType::FLOAT), floatPtr(ptr) {}
+	OscParameter(const std::string& addr, bool* ptr)
+		: address(addr), type(OscParamType::BOOL), boolPtr(ptr), minValue(0.0f), maxValue(1.0f) {}
+	OscParameter(const std::string& addr, int* ptr)
+		: address(addr), type(OscParamType::INT), intPtr(ptr), minValue(0.0f), maxValue(127.0f) {}
+	OscParameter() : address(""), type(OscParamType::FLOAT), floatPtr(nullptr) {}
+
+	// Get value as float (for sending)
+	float getValueAsFloat() const {
+		switch(type) {
+			case OscParamType::FLOAT: return floatPtr ? *floatPtr : 0.0f;
+			case OscParamType::BOOL: return boolPtr ? (*boolPtr ? 1.0f : 0.0f) : 0.0f;
+			case OscParamType::INT: return intPtr ? static_cast<float>(*intPtr) : 0.0f;
+		}
+		return 0.0f;
+	}
+
+	// Set value from float (for receiving)
+	void setValueFromFloat(float value) {
+		switch(type) {
+			case OscParamType::FLOAT:
+				if(floatPtr) *floatPtr = value;
+				break;
+			case OscParamType::BOOL:
+				if(boolPtr) *boolPtr = (value > 0.5f);
+				break;
+			case OscParamType::INT:
+				if(intPtr) *intPtr = static_cast<int>(value);
+				break;
+		}
+	}
+};
+
+// Parts of the patch, used as a bit mask to scope resets and randomizing
+enum ParamSection {
+	SECTION_BLOCK1_INPUT = 1 << 0,
+	SECTION_FB1 = 1 << 1,
+	SECTION_BLOCK2_INPUT = 1 << 2,
+	SECTION_FB2 = 1 << 3,
+	SECTION_BLOCK3 = 1 << 4,
+
+	SECTION_BLOCK1 = SECTION_BLOCK1_INPUT | SECTION_FB1,
+	SECTION_BLOCK2 = SECTION_BLOCK2_INPUT | SECTION_FB2,
+	SECTION_ALL = SECTION_BLOCK1 | SECTION_BLOCK2 | SECTION_BLOCK3
+};
+
+// Which resets put a parameter back to its default
+enum class ParamReset {
+	NEVER,      // routing and session state: input selects, aspect ratios, switches
+	FULL,       // only the full reset
+	SECTION     // the reset of its section and the full reset
+};
+
+// How the amp and rate controls of an lfo group are laid out in its array
+enum class LfoLayout {
+	INTERLEAVED,    // amp0, rate0, amp1, rate1, ...
+	BANDED          // in threes: amp0, amp1, amp2, rate0, rate1, rate2, amp3, ...
+};
+
+// Where a single value lives in a preset: [block][key][index] or [block][key][field]
+struct PresetSlot {
+	std::string key;
+	int index = -1;
+	std::string field;
+
+	PresetSlot() {}
+	PresetSlot(const char* k, int i) : key(k), index(i) {}
+	PresetSlot(const char* k, const char* f) : key(k), field(f) {}
+};
+
+struct ParamDef {
+	std::string name;
+	OscParameter handle;
+	std::string block;          // preset block, "BLOCK_1" .. "BLOCK_3"
+	PresetSlot slot;            // empty key for values that are not saved
+	int section = 0;
+	int group = -1;             // owning array group, -1 for single values
+	int lfoTarget = -1;         // parameter an lfo control modulates, -1 if none
+	float defaultValue = 0.0f;
+	ParamReset reset = ParamReset::NEVER;
+
+	ParamDef& resetTo(float value, ParamReset when = ParamReset::SECTION) {
+		defaultValue = value;
+		reset = when;
+		return *this;
+	}
+	ParamDef& range(float minValue, float maxValue) {
+		handle.minValue = minValue;
+		handle.maxValue = maxValue;
+		return *this;
+	}
+};
+
+// A PARAMETER_ARRAY_LENGTH slice of the flat parameter store. Groups are
+// saved and reset as whole arrays, unused slots included.
+struct ParamGroup {
+	std::string key;
+	std::string block;
+	int section = 0;
+	float* values = nullptr;
+	bool* midiActive = nullptr;
+	int* shapes = nullptr;      // lfo groups only
+	bool saveValues = true;     // legacy groups only keep their shapes in presets
+};
+
+// One saved value in the flat preset layout: a group slot, a group lfo
+// shape or a single value parameter
+struct PresetField {
+	uint32_t id = 0;            // hash of block/key/index, stable across builds
+	int group = -1;
+	int index = 0;
+	bool shape = false;
+	int param = -1;
+};
+
+// One table describing every parameter: storage, preset location, OSC
+// address, default, reset scope and lfo pairing. Presets, resets, randomizing
+// and the OSC registry are all generic loops over it.
+class ParameterSchema {
+public:
+	void clear();
+
+	// Following adds go to this section, preset block and OSC address prefix
+	void begin(int section, const std::string& block, const std::string& oscPrefix);
+	void setPrefix(const std::string& oscPrefix) { prefix = oscPrefix; }
+
+	// names are the OSC names of slots 0, 1, 2 ...
+	ParamGroup& addGroup(const std::string& key, float* values, bool* midiActive,
+		std::initializer_list<const char*> names);
+	// names are the targets in the group called targetKey; each one gets
+	// <name>Amp, <name>Rate and <name>Shape addresses
+	ParamGroup& addLfoGroup(const std::string& key, float* values, bool* midiActive, int* shapes,
+		LfoLayout layout, const std::string& targetKey, std::initializer_list<const char*> names);
+
+	ParamDef& add(const std::string& name, float* ptr, const PresetSlot& slot = PresetSlot());
+	ParamDef& add(const std::string& name, bool* ptr, const PresetSlot& slot = PresetSlot());
+	ParamDef& add(const std::string& name, int* ptr, const PresetSlot& slot = PresetSlot());
+
+	// Amp / rate / shape triple for a single value lfo, saved as <name>Amp ... under key
+	void addLfo(const std::string& name, float* amp, float* rate, int* shape,
+		const std::string& key, const float* target);
+
+	// Second OSC address for an already registered parameter
+	void addAlias(const std::string& address, const std::string& targetAddress);
+
+	const std::vector<ParamDef>& getParams() const { return params; }
+	const std::vector<ParamGroup>& getGroups() const { return groups; }
+	int findParam(const std::string& address) const;
+	int findGroup(const std::string& key) const;
+
+	// Builds the flat preset layout once every parameter has been added
+	void finalize();
+	const std::vector<PresetField>& getFields() const { return fields; }
+	int findField(uint32_t id) const;
+	// Changes whenever fields are added, removed or reordered
+	uint32_t getLayoutHash() const { return layoutHash; }
+	static uint32_t fieldId(const std::string& block, const std::string& key, const std::string& slot);
+
+	// Values in field order into parameter storage; NaN keeps the current value
+	void apply(const std::vector<float>& values);
+	// Preset JSON from values in field order; only uses the layout
+	void write(const std::vector<float>& values, ofJson& json) const;
+	// What a preset missing every value would load
+	void defaults(std::vector<float>& values) const;
+	// Current values in field order
+	void capture(std::vector<float>& values) const;
+	void reset(int sections, bool full);
+	void randomize(int sections, float amount);
+
+private:
+	ParamDef& addParam(const std::string& name, const OscParameter& handle, const PresetSlot& slot);
+
+	std::vector<ParamDef> params;
+	std::vector<ParamGroup> groups;
+	std::map<std::string, int> addressIndex;
+	std::vector<PresetField> fields;
+	std::unordered_map<uint32_t, int> fieldIndex;
+	uint32_t layoutHash = 0;
+
+	int section = 0;
+	std::string block;
+	std::string prefix;
+};
@@ -0,0 +1,60 @@
+#include "ParticleGenerator.h"
+
+//--------------------------------------------------------------
+bool ParticleGenerator::setup(const std::string& shaderDir) {
+	bool computeLoaded = computeShader.setupShaderFromFile(GL_COMPUTE_SHADER, shaderDir + "/particles.comp")
+		&& computeShader.linkProgram();
+	if (!computeLoaded || !drawShader.load(shaderDir + "/particles")) {
+		ofLogError("Shader") << "Particle shaders failed to load, particles are disabled";
+		return false;
+	}
+
+	// Zeroed particles have no lifetime left, so the first dispatch spawns them all
+	std::vector<Particle> empty(MAX_PARTICLES, Particle{ glm::vec4(0), glm::vec4(0) });
+	for (auto& buffer : particles) {
+		buffer.allocate(empty, GL_DYNAMIC_COPY);
+	}
+	glGenVertexArrays(1, &vao);
+	loaded = true;
+	return true;
+}
+
+//--------------------------------------------------------------
+void ParticleGenerator::update(int block, const ofTexture& field, glm::vec2 fieldScale, const Settings& settings) {
+	if (!loaded || settings.count <= 0) return;
+	int count = std::min(settings.count, (int)MAX_PARTICLES);
+
+	particles[block].bindBase(GL_SHADER_STORAGE_BUFFER, 0);
+	computeShader.begin();
+	computeShader.setUniformTexture("field", field, 0);
+	computeShader.setUniform2f("texelSize", 1.0f / field.getWidth(), 1.0f / field.getHeight());
+	computeShader.setUniform2f("fieldScale", fieldScale);
+	glUniform1ui(computeShader.getUniformLocation("count"), count);
+	glUniform1ui(computeShader.getUniformLocation("frame"), frame++);
+	computeShader.setUniform1f("speed", settings.speed);
+	computeShader.setUniform1f("flow", settings.flow);
+	computeShader.dispatchCompute((count + WORK_GROUP_SIZE - 1) / WORK_GROUP_SIZE, 1, 1);
+	computeShader.end();
+	particles[block].unbindBase(GL_SHADER_STORAGE_BUFFER, 0);
+
+	// The vertex shader reads what the dispatch wrote
+	glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+}
+
+//--------------------------------------------------------------
+void ParticleGenerator::draw(int block, const Settings& settings) {
+	if (!loaded || settings.count <= 0) return;
+	int count = std::min(settings.count, (int)MAX_PARTICLES);
+
+	particles[block].bindBase(GL_SHADER_STORAGE_BUFFER, 0);
+	glEnable(GL_PROGRAM_POINT_SIZE);
+	drawShader.begin();
+	drawShader.setUniform1f("pointSize", settings.pointSize);
+	drawShader.setUniform1f("hue", settings.hue);
+	glBindVertexArray(vao);
+	glDrawArraysInstanced(GL_POINTS, 0, 1, count);
+	glBindVertexArray(0);
+	drawShader.end();
+	glDisable(GL_PROGRAM_POINT_SIZE);
+	particles[block].unbindBase(GL_SHADER_STORAGE_BUFFER, 0);
+}
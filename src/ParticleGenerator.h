@@ -0,0 +1,43 @@
+#pragma once
+
+#include "ofMain.h"
+
+// GPU particle generator for blocks 1 and 2. Each block's particles live in
+// a shader storage buffer, are advanced by shadersGL4/particles.comp against
+// that block's last feedback frame and drawn as instanced points by
+// particles.vert. Nothing per particle ever touches the CPU.
+class ParticleGenerator {
+public:
+	static const int BLOCKS = 2;
+	static const int MAX_PARTICLES = 1 << 18;
+	static const int WORK_GROUP_SIZE = 256;     // local_size_x in particles.comp
+
+	struct Settings {
+		int count = 0;
+		float speed = 0;                        // 0 - 1, pull of the gradient
+		float flow = 0;                         // 0 uphill, 1 along the contours
+		float pointSize = 1;                    // pixels
+		float hue = 0;
+	};
+
+	bool setup(const std::string& shaderDir);
+	// Advances the block's particles one frame over field, of which the
+	// lower left fieldScale holds the frame (see ResolutionGovernor)
+	void update(int block, const ofTexture& field, glm::vec2 fieldScale, const Settings& settings);
+	// Draws them into the bound framebuffer
+	void draw(int block, const Settings& settings);
+
+private:
+	// std430 mirror of Particle in particles.comp
+	struct Particle {
+		glm::vec4 state;
+		glm::vec4 life;
+	};
+
+	ofShader computeShader;
+	ofShader drawShader;
+	ofBufferObject particles[BLOCKS];
+	GLuint vao = 0;
+	bool loaded = false;
+	unsigned int frame = 0;
+};
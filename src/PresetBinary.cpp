@@ -0,0 +1,103 @@
+#include "PresetBinary.h"
+
+#ifdef TARGET_WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+//--------------------------------------------------------------
+PresetBinaryFile::~PresetBinaryFile() {
+	close();
+}
+
+//--------------------------------------------------------------
+bool PresetBinaryFile::open(const std::string& path) {
+	close();
+	std::string fullPath = ofToDataPath(path, true);
+
+#ifdef TARGET_WIN32
+	HANDLE file = CreateFileA(fullPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) return false;
+	fileHandle = file;
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < (LONGLONG)sizeof(PresetBinaryHeader)) {
+		close();
+		return false;
+	}
+	size = (size_t)fileSize.QuadPart;
+	mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!mappingHandle) {
+		close();
+		return false;
+	}
+	data = (const uint8_t*)MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+#else
+	fd = ::open(fullPath.c_str(), O_RDONLY);
+	if (fd < 0) return false;
+	struct stat info;
+	if (fstat(fd, &info) != 0 || info.st_size < (off_t)sizeof(PresetBinaryHeader)) {
+		close();
+		return false;
+	}
+	size = (size_t)info.st_size;
+	void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	data = mapped == MAP_FAILED ? nullptr : (const uint8_t*)mapped;
+#endif
+
+	if (!data) {
+		close();
+		return false;
+	}
+
+	const PresetBinaryHeader& header = getHeader();
+	if (memcmp(header.magic, "GWPB", 4) != 0 || header.version == 0 || header.version > VERSION) {
+		ofLogWarning("Preset Binary") << path << " is not a preset this build can read";
+		close();
+		return false;
+	}
+	if (size < sizeof(PresetBinaryHeader) + (size_t)header.count * sizeof(PresetBinaryEntry)) {
+		ofLogWarning("Preset Binary") << path << " is truncated";
+		close();
+		return false;
+	}
+	return true;
+}
+
+//--------------------------------------------------------------
+void PresetBinaryFile::close() {
+#ifdef TARGET_WIN32
+	if (data) UnmapViewOfFile(data);
+	if (mappingHandle) CloseHandle((HANDLE)mappingHandle);
+	if (fileHandle) CloseHandle((HANDLE)fileHandle);
+	mappingHandle = nullptr;
+	fileHandle = nullptr;
+#else
+	if (data) munmap((void*)data, size);
+	if (fd >= 0) ::close(fd);
+	fd = -1;
+#endif
+	data = nullptr;
+	size = 0;
+}
+
+//--------------------------------------------------------------
+bool PresetBinaryFile::write(const std::string& path, uint32_t schemaHash, const std::vector<PresetBinaryEntry>& entries) {
+	PresetBinaryHeader header;
+	memcpy(header.magic, "GWPB", 4);
+	header.version = VERSION;
+	header.schemaHash = schemaHash;
+	header.count = (uint32_t)entries.size();
+
+	std::ofstream out(ofToDataPath(path, true), std::ios::binary | std::ios::trunc);
+	if (!out) {
+		ofLogError("Preset Binary") << "Could not write " << path;
+		return false;
+	}
+	out.write((const char*)&header, sizeof(header));
+	out.write((const char*)entries.data(), entries.size() * sizeof(PresetBinaryEntry));
+	return (bool)out;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "ofMain.h"
+
+// Binary preset file (.gwpb), written next to the JSON preset:
+//   header   "GWPB", format version, schema layout hash, entry count
+//   entries  count x { field id, value }
+// Ids are the stable hashes from ParameterSchema::fieldId, so a file stays
+// readable after parameters are added or removed. When the layout hash
+// still matches, the first entries are exactly the schema fields in order
+// and are copied without any lookup. Values are stored little endian.
+struct PresetBinaryHeader {
+	char magic[4];
+	uint32_t version;
+	uint32_t schemaHash;
+	uint32_t count;
+};
+
+struct PresetBinaryEntry {
+	uint32_t id;
+	float value;
+};
+
+// A .gwpb file mapped read only into memory
+class PresetBinaryFile {
+public:
+	static const uint32_t VERSION = 1;
+
+	PresetBinaryFile() {}
+	~PresetBinaryFile();
+	PresetBinaryFile(const PresetBinaryFile&) = delete;
+	PresetBinaryFile& operator=(const PresetBinaryFile&) = delete;
+
+	// Maps path and checks magic, version and size
+	bool open(const std::string& path);
+	void close();
+
+	const PresetBinaryHeader& getHeader() const { return *reinterpret_cast<const PresetBinaryHeader*>(data); }
+	const PresetBinaryEntry* getEntries() const { return reinterpret_cast<const PresetBinaryEntry*>(data + sizeof(PresetBinaryHeader)); }
+	uint32_t getCount() const { return getHeader().count; }
+
+	static bool write(const std::string& path, uint32_t schemaHash, const std::vector<PresetBinaryEntry>& entries);
+
+private:
+	const uint8_t* data = nullptr;
+	size_t size = 0;
+#ifdef TARGET_WIN32
+	void* fileHandle = nullptr;
+	void* mappingHandle = nullptr;
+#else
+	int fd = -1;
+#endif
+};
@@ -0,0 +1,236 @@
+#include "PresetIndex.h"
+
+#ifdef TARGET_LINUX
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+//--------------------------------------------------------------
+void PresetIndex::setup(const std::string& presetRoot) {
+	root = presetRoot;
+	startThread();
+}
+
+//--------------------------------------------------------------
+void PresetIndex::stop() {
+	waitForThread(true);
+}
+
+//--------------------------------------------------------------
+PresetIndex::Banks PresetIndex::getBanks() {
+	std::unique_lock<std::mutex> lock(mutex);
+	return banks;
+}
+
+//--------------------------------------------------------------
+void PresetIndex::addPreset(const std::string& bank, const std::string& fileName) {
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		std::vector<std::string>& files = banks[bank];
+		auto it = std::lower_bound(files.begin(), files.end(), fileName);
+		if (it != files.end() && *it == fileName) return;
+		files.insert(it, fileName);
+	}
+	changed();
+}
+
+//--------------------------------------------------------------
+void PresetIndex::removePreset(const std::string& bank, const std::string& fileName) {
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		auto bankIt = banks.find(bank);
+		if (bankIt == banks.end()) return;
+		std::vector<std::string>& files = bankIt->second;
+		auto it = std::lower_bound(files.begin(), files.end(), fileName);
+		if (it == files.end() || *it != fileName) return;
+		files.erase(it);
+	}
+	changed();
+}
+
+//--------------------------------------------------------------
+void PresetIndex::rescan() {
+	rescanRequested = true;
+}
+
+//--------------------------------------------------------------
+void PresetIndex::changed() {
+	version++;
+}
+
+//--------------------------------------------------------------
+bool PresetIndex::isPresetFile(const std::string& fileName) {
+	return fileName.size() > 5 && fileName.compare(fileName.size() - 5, 5, ".json") == 0;
+}
+
+//--------------------------------------------------------------
+std::vector<std::string> PresetIndex::listBank(const std::string& bank) const {
+	std::vector<std::string> files;
+	std::error_code error;
+	for (const auto& entry : std::filesystem::directory_iterator(ofToDataPath(root + "/" + bank, true), error)) {
+		std::string fileName = entry.path().filename().string();
+		if (entry.is_regular_file(error) && isPresetFile(fileName)) files.push_back(fileName);
+	}
+	std::sort(files.begin(), files.end());
+	return files;
+}
+
+//--------------------------------------------------------------
+void PresetIndex::scanBank(const std::string& bank) {
+	std::vector<std::string> files = listBank(bank);
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		banks[bank] = std::move(files);
+	}
+	changed();
+}
+
+//--------------------------------------------------------------
+void PresetIndex::scanAll() {
+	// Built aside and swapped in whole, so the GUI never sees half a scan
+	Banks scanned;
+	size_t presetCount = 0;
+	std::error_code error;
+	for (const auto& entry : std::filesystem::directory_iterator(ofToDataPath(root, true), error)) {
+		if (!entry.is_directory(error)) continue;
+		std::string bank = entry.path().filename().string();
+		scanned[bank] = listBank(bank);
+		presetCount += scanned[bank].size();
+#ifdef TARGET_LINUX
+		addWatch(bank);
+#endif
+	}
+
+	size_t bankCount = scanned.size();
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		banks = std::move(scanned);
+	}
+	changed();
+	ofLogNotice("Preset Index") << "Indexed " << presetCount << " presets in " << bankCount << " banks";
+}
+
+#ifdef TARGET_LINUX
+//--------------------------------------------------------------
+void PresetIndex::addWatch(const std::string& bank) {
+	if (inotifyFd < 0) return;
+	std::string path = ofToDataPath(bank.empty() ? root : root + "/" + bank, true);
+	uint32_t mask = IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF;
+	int wd = inotify_add_watch(inotifyFd, path.c_str(), mask);
+	if (wd < 0) {
+		ofLogWarning("Preset Index") << "Cannot watch " << path;
+		return;
+	}
+	watches[wd] = bank;
+}
+
+//--------------------------------------------------------------
+void PresetIndex::readEvents() {
+	alignas(struct inotify_event) char buffer[4096];
+	ssize_t length;
+	while ((length = read(inotifyFd, buffer, sizeof(buffer))) > 0) {
+		for (char* p = buffer; p < buffer + length;) {
+			const struct inotify_event* event = (const struct inotify_event*)p;
+			p += sizeof(struct inotify_event) + event->len;
+
+			if (event->mask & IN_Q_OVERFLOW) {
+				rescanRequested = true;
+				continue;
+			}
+			auto watch = watches.find(event->wd);
+			if (watch == watches.end()) continue;
+			if (event->mask & IN_IGNORED) {
+				watches.erase(watch);
+				continue;
+			}
+			if (event->len == 0) continue;
+
+			std::string name = event->name;
+			bool added = event->mask & (IN_CREATE | IN_MOVED_TO);
+			bool removed = event->mask & (IN_DELETE | IN_MOVED_FROM);
+
+			if (watch->second.empty()) {
+				// A bank folder in the root
+				if (!(event->mask & IN_ISDIR)) continue;
+				if (added) {
+					addWatch(name);
+					scanBank(name);
+				} else if (removed) {
+					std::unique_lock<std::mutex> lock(mutex);
+					banks.erase(name);
+					lock.unlock();
+					changed();
+				}
+			} else if (isPresetFile(name)) {
+				// Saves land as a rename of the temporary file, which is a move to
+				if (added) addPreset(watch->second, name);
+				else if (removed) removePreset(watch->second, name);
+			}
+		}
+	}
+}
+
+//--------------------------------------------------------------
+void PresetIndex::threadedFunction() {
+	inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (inotifyFd < 0) ofLogWarning("Preset Index") << "inotify unavailable, the index only updates on refresh";
+	addWatch("");
+	scanAll();
+
+	while (isThreadRunning()) {
+		if (rescanRequested.exchange(false)) scanAll();
+		if (inotifyFd < 0) {
+			ofSleepMillis(250);
+			continue;
+		}
+		struct pollfd fd = { inotifyFd, POLLIN, 0 };
+		if (poll(&fd, 1, 250) > 0) readEvents();
+	}
+
+	if (inotifyFd >= 0) close(inotifyFd);
+	inotifyFd = -1;
+	watches.clear();
+}
+
+#else
+//--------------------------------------------------------------
+void PresetIndex::pollModified() {
+	// A folder's modification time changes when a file in it is added, removed or renamed
+	std::error_code error;
+	auto rootTime = std::filesystem::last_write_time(ofToDataPath(root, true), error);
+	if (!error && rootTime != folderTimes[""]) {
+		folderTimes.clear();
+		folderTimes[""] = rootTime;
+		scanAll();
+	}
+
+	std::vector<std::string> bankNames;
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		for (const auto& bank : banks) bankNames.push_back(bank.first);
+	}
+	for (const auto& bank : bankNames) {
+		auto bankTime = std::filesystem::last_write_time(ofToDataPath(root + "/" + bank, true), error);
+		if (error) continue;
+		auto it = folderTimes.find(bank);
+		if (it == folderTimes.end()) {
+			folderTimes[bank] = bankTime;
+		} else if (it->second != bankTime) {
+			it->second = bankTime;
+			scanBank(bank);
+		}
+	}
+}
+
+//--------------------------------------------------------------
+void PresetIndex::threadedFunction() {
+	while (isThreadRunning()) {
+		if (rescanRequested.exchange(false)) {
+			folderTimes.clear();
+		}
+		pollModified();
+		ofSleepMillis(1000);
+	}
+}
+#endif
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "ofMain.h"
+#include <atomic>
+#include <filesystem>
+
+// Keeps the list of banks (subfolders of the presets folder) and their
+// .json presets. The folder is scanned once on a worker thread and then
+// kept current from inotify events on Linux. Other platforms fall back to
+// rescanning a folder only when its modification time changes. The GUI
+// copies the index when getVersion() moves, so nothing lists directories
+// per frame or per save.
+class PresetIndex : public ofThread {
+public:
+	// Bank name -> preset file names, both sorted
+	typedef std::map<std::string, std::vector<std::string>> Banks;
+
+	void setup(const std::string& root);
+	void stop();
+
+	const std::string& getRoot() const { return root; }
+	// Bumped on every change; 0 until the first scan is done
+	uint64_t getVersion() const { return version; }
+	Banks getBanks();
+
+	// Files this app wrote or renamed, listed before the watcher reports them
+	void addPreset(const std::string& bank, const std::string& fileName);
+	void removePreset(const std::string& bank, const std::string& fileName);
+	// Full scan on the worker, e.g. for the refresh button
+	void rescan();
+
+private:
+	void threadedFunction() override;
+	void scanAll();
+	std::vector<std::string> listBank(const std::string& bank) const;
+	void scanBank(const std::string& bank);
+	void changed();
+	static bool isPresetFile(const std::string& fileName);
+
+	std::string root;
+	std::atomic<uint64_t> version{0};
+	std::atomic<bool> rescanRequested{false};
+
+	// Guarded by mutex
+	Banks banks;
+
+#ifdef TARGET_LINUX
+	void addWatch(const std::string& bank);
+	void readEvents();
+
+	int inotifyFd = -1;
+	std::map<int, std::string> watches;     // watch descriptor -> bank, "" for the root
+#else
+	void pollModified();
+
+	std::map<std::string, std::filesystem::file_time_type> folderTimes;     // "" for the root
+#endif
+};
@@ -0,0 +1,126 @@
+#include "PresetJsonReader.h"
+
+namespace {
+	// Same FNV-1a as ParameterSchema::fieldId, continued from hash
+	inline uint32_t hashAppend(uint32_t hash, const char* text, size_t length) {
+		for (size_t i = 0; i < length; i++) {
+			hash ^= (unsigned char)text[i];
+			hash *= 16777619u;
+		}
+		return hash;
+	}
+
+	inline uint32_t hashAppend(uint32_t hash, int number) {
+		char digits[16];
+		int length = snprintf(digits, sizeof(digits), "%d", number);
+		return hashAppend(hash, digits, length);
+	}
+
+	// Values sit at root / block / key / slot
+	const size_t VALUE_DEPTH = 3;
+}
+
+//--------------------------------------------------------------
+bool PresetJsonReader::parse(const char* data, size_t size) {
+	frames.clear();
+	error.clear();
+	return ofJson::sax_parse(data, data + size, this);
+}
+
+//--------------------------------------------------------------
+uint32_t PresetJsonReader::childHash() const {
+	if (frames.empty()) return 2166136261u;
+	const Frame& frame = frames.back();
+	if (frame.array) return hashAppend(frame.prefix, frame.index);
+	return hashAppend(frame.prefix, currentKey.data(), currentKey.size());
+}
+
+//--------------------------------------------------------------
+void PresetJsonReader::value(float number) {
+	if (frames.size() == VALUE_DEPTH) onValue(childHash(), number);
+	next();
+}
+
+//--------------------------------------------------------------
+void PresetJsonReader::next() {
+	if (!frames.empty() && frames.back().array) frames.back().index++;
+}
+
+//--------------------------------------------------------------
+bool PresetJsonReader::null() {
+	next();
+	return true;
+}
+
+bool PresetJsonReader::boolean(bool b) {
+	value(b ? 1.0f : 0.0f);
+	return true;
+}
+
+bool PresetJsonReader::number_integer(number_integer_t number) {
+	value((float)number);
+	return true;
+}
+
+bool PresetJsonReader::number_unsigned(number_unsigned_t number) {
+	value((float)number);
+	return true;
+}
+
+bool PresetJsonReader::number_float(number_float_t number, const string_t&) {
+	value((float)number);
+	return true;
+}
+
+bool PresetJsonReader::string(string_t&) {
+	next();
+	return true;
+}
+
+bool PresetJsonReader::binary(binary_t&) {
+	next();
+	return true;
+}
+
+//--------------------------------------------------------------
+bool PresetJsonReader::start_object(std::size_t) {
+	Frame frame;
+	frame.prefix = frames.empty() ? childHash() : hashAppend(childHash(), "/", 1);
+	frame.array = false;
+	frame.index = 0;
+	frames.push_back(frame);
+	return true;
+}
+
+bool PresetJsonReader::key(string_t& name) {
+	currentKey = name;
+	return true;
+}
+
+bool PresetJsonReader::end_object() {
+	frames.pop_back();
+	next();
+	return true;
+}
+
+//--------------------------------------------------------------
+bool PresetJsonReader::start_array(std::size_t) {
+	Frame frame;
+	frame.prefix = frames.empty() ? childHash() : hashAppend(childHash(), "/", 1);
+	frame.array = true;
+	frame.index = 0;
+	frames.push_back(frame);
+	return true;
+}
+
+bool PresetJsonReader::end_array() {
+	frames.pop_back();
+	next();
+	return true;
+}
+
+//--------------------------------------------------------------
+bool PresetJsonReader::parse_error(std::size_t position, const std::string&, const nlohmann::detail::exception& ex) {
+	error = "at byte " + ofToString(position) + ": " + ex.what();
+	return false;
+}
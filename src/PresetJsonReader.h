@@ -0,0 +1,51 @@
+#pragma once
+
+#include "ofMain.h"
+#include <functional>
+
+// Streaming reader for JSON presets. It walks the file once with the
+// nlohmann SAX interface, without building a document. Every number or
+// bool found at [block][key][index] or [block][key][field] is reported
+// with its ParameterSchema::fieldId. The id is hashed incrementally
+// along the path, so no key strings are built. Values anywhere else are
+// skipped, and keys the caller does not know are simply not matched.
+class PresetJsonReader : public nlohmann::json_sax<ofJson> {
+public:
+	using ValueCallback = std::function<void(uint32_t id, float value)>;
+
+	explicit PresetJsonReader(const ValueCallback& onValue) : onValue(onValue) {}
+
+	bool parse(const char* data, size_t size);
+	const std::string& getError() const { return error; }
+
+	bool null() override;
+	bool boolean(bool value) override;
+	bool number_integer(number_integer_t value) override;
+	bool number_unsigned(number_unsigned_t value) override;
+	bool number_float(number_float_t value, const string_t& text) override;
+	bool string(string_t& value) override;
+	bool binary(binary_t& value) override;
+	bool start_object(std::size_t elements) override;
+	bool key(string_t& value) override;
+	bool end_object() override;
+	bool start_array(std::size_t elements) override;
+	bool end_array() override;
+	bool parse_error(std::size_t position, const std::string& lastToken, const nlohmann::detail::exception& ex) override;
+
+private:
+	struct Frame {
+		uint32_t prefix;    // hash of "block/key/" up to this container
+		bool array;
+		int index;
+	};
+
+	// Hash of this frame's prefix extended by the current key or index
+	uint32_t childHash() const;
+	void value(float value);
+	void next();
+
+	ValueCallback onValue;
+	std::vector<Frame> frames;
+	std::string currentKey;
+	std::string error;
+};
@@ -0,0 +1,166 @@
+#include "PresetLoader.h"
+#include "GuiApp.h"
+
+//--------------------------------------------------------------
+void PresetLoader::setup(const GuiApp* guiApp) {
+	gui = guiApp;
+	startThread();
+}
+
+//--------------------------------------------------------------
+void PresetLoader::stop() {
+	stopThread();
+	condition.notify_all();
+	loaded.close();
+	waitForThread(false);
+}
+
+//--------------------------------------------------------------
+void PresetLoader::setBank(const std::vector<PresetFile>& presets) {
+	std::unique_lock<std::mutex> lock(mutex);
+	bank = presets;
+
+	std::set<std::string> paths;
+	for (const auto& file : presets) paths.insert(file.path);
+	for (auto it = cache.begin(); it != cache.end();) {
+		if (paths.count(it->first)) ++it;
+		else it = cache.erase(it);
+	}
+
+	// Reversed so the first presets of the bank are ready first
+	prefetchQueue.assign(presets.rbegin(), presets.rend());
+	condition.notify_all();
+}
+
+//--------------------------------------------------------------
+void PresetLoader::invalidate(const std::string& path) {
+	std::unique_lock<std::mutex> lock(mutex);
+	cache.erase(path);
+	for (const auto& file : bank) {
+		if (file.path == path) {
+			prefetchQueue.push_back(file);
+			condition.notify_all();
+			break;
+		}
+	}
+}
+
+//--------------------------------------------------------------
+bool PresetLoader::getCached(const std::string& path, PresetSnapshot& snapshot) {
+	std::unique_lock<std::mutex> lock(mutex);
+	auto it = cache.find(path);
+	if (it == cache.end()) return false;
+	snapshot = it->second.snapshot;
+	return true;
+}
+
+//--------------------------------------------------------------
+void PresetLoader::requestLoad(const std::string& path, const std::string& name) {
+	std::unique_lock<std::mutex> lock(mutex);
+	pendingLoad.path = path;
+	pendingLoad.name = name;
+	loadPending = true;
+	condition.notify_all();
+}
+
+//--------------------------------------------------------------
+bool PresetLoader::getLoaded(PresetSnapshot& snapshot) {
+	bool found = false;
+	// Keep only the newest if several finished in one frame
+	while (loaded.tryReceive(snapshot)) found = true;
+	return found;
+}
+
+//--------------------------------------------------------------
+bool PresetLoader::getModified(const std::string& path, std::filesystem::file_time_type& modified) {
+	std::error_code error;
+	modified = std::filesystem::last_write_time(ofToDataPath(path, true), error);
+	return !error;
+}
+
+//--------------------------------------------------------------
+bool PresetLoader::load(const PresetFile& file, PresetSnapshot& snapshot) {
+	std::filesystem::file_time_type modified;
+	if (!getModified(file.path, modified)) {
+		ofLogError("Preset Loader") << "Preset not found: " << file.path;
+		return false;
+	}
+
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		auto it = cache.find(file.path);
+		if (it != cache.end() && it->second.modified == modified) {
+			snapshot = it->second.snapshot;
+			return true;
+		}
+	}
+
+	snapshot.name = file.name;
+	snapshot.path = file.path;
+	uint64_t start = ofGetElapsedTimeMicros();
+	if (!gui->readPresetFile(file.path, snapshot)) return false;
+	ofLogVerbose("Preset Loader") << "Parsed " << file.name << " in "
+		<< (ofGetElapsedTimeMicros() - start) / 1000.0f << " ms";
+
+	std::unique_lock<std::mutex> lock(mutex);
+	for (const auto& bankFile : bank) {
+		if (bankFile.path == file.path) {
+			CacheEntry& entry = cache[file.path];
+			entry.modified = modified;
+			entry.snapshot = snapshot;
+			break;
+		}
+	}
+	return true;
+}
+
+//--------------------------------------------------------------
+void PresetLoader::checkModified() {
+	std::vector<std::pair<std::string, std::filesystem::file_time_type>> cached;
+	{
+		std::unique_lock<std::mutex> lock(mutex);
+		for (const auto& entry : cache) cached.emplace_back(entry.first, entry.second.modified);
+	}
+
+	for (const auto& entry : cached) {
+		std::filesystem::file_time_type modified;
+		if (!getModified(entry.first, modified) || modified != entry.second) {
+			invalidate(entry.first);
+		}
+	}
+}
+
+//--------------------------------------------------------------
+void PresetLoader::threadedFunction() {
+	while (isThreadRunning()) {
+		PresetFile file;
+		bool isLoad = false;
+		bool isPrefetch = false;
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			condition.wait_for(lock, std::chrono::seconds(1), [this] {
+				return loadPending || !prefetchQueue.empty() || !isThreadRunning();
+			});
+			// A requested load always goes before the background prefetch
+			if (loadPending) {
+				file = pendingLoad;
+				loadPending = false;
+				isLoad = true;
+			} else if (!prefetchQueue.empty()) {
+				file = prefetchQueue.back();
+				prefetchQueue.pop_back();
+				isPrefetch = true;
+			}
+		}
+
+		if (isLoad) {
+			PresetSnapshot snapshot;
+			if (load(file, snapshot)) loaded.send(std::move(snapshot));
+		} else if (isPrefetch) {
+			PresetSnapshot snapshot;
+			load(file, snapshot);
+		} else if (isThreadRunning()) {
+			checkModified();
+		}
+	}
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "ofMain.h"
+#include "ParameterSchema.h"
+#include <condition_variable>
+#include <filesystem>
+
+class GuiApp;
+
+// Everything a preset sets, parsed and ready to apply with plain copies
+struct PresetSnapshot {
+	std::string name;
+	std::string path;
+	std::vector<float> values;      // ParameterSchema fields, NaN keeps the current value
+	float macroData[PARAMETER_ARRAY_LENGTH] = {};
+	int macroAssignGroup[PARAMETER_ARRAY_LENGTH];
+	int macroAssignParam[PARAMETER_ARRAY_LENGTH] = {};
+
+	PresetSnapshot() {
+		for (int i = 0; i < PARAMETER_ARRAY_LENGTH; i++) macroAssignGroup[i] = -1;
+	}
+};
+
+// Reads and parses preset files on a worker thread. The GUI queues a
+// request and picks the finished snapshot up at the start of a later
+// frame, so file access and JSON parsing never stall the output.
+//
+// Every preset of the current load bank is also parsed in the background
+// and kept in memory, so recalling one from the bank is a copy. Cached
+// entries are checked against the file's modification time about once a
+// second and parsed again when the file changed.
+class PresetLoader : public ofThread {
+public:
+	struct PresetFile {
+		std::string path;
+		std::string name;
+	};
+
+	void setup(const GuiApp* gui);
+	void stop();
+
+	// Replaces the cached bank; entries of other banks are dropped
+	void setBank(const std::vector<PresetFile>& presets);
+	// Parses path again in the background, after it was written or renamed
+	void invalidate(const std::string& path);
+
+	// Copies a cached snapshot, false if path is not parsed (yet)
+	bool getCached(const std::string& path, PresetSnapshot& snapshot);
+
+	// Only the newest request matters; an older pending one is skipped
+	void requestLoad(const std::string& path, const std::string& name);
+	// Non blocking; true when a snapshot finished since the last call
+	bool getLoaded(PresetSnapshot& snapshot);
+
+private:
+	struct CacheEntry {
+		std::filesystem::file_time_type modified;
+		PresetSnapshot snapshot;
+	};
+
+	void threadedFunction() override;
+	bool load(const PresetFile& file, PresetSnapshot& snapshot);
+	void checkModified();
+	static bool getModified(const std::string& path, std::filesystem::file_time_type& modified);
+
+	const GuiApp* gui = nullptr;
+
+	// Guarded by mutex
+	std::condition_variable condition;
+	bool loadPending = false;
+	PresetFile pendingLoad;
+	std::vector<PresetFile> bank;
+	std::vector<PresetFile> prefetchQueue;     // taken from the back
+	std::map<std::string, CacheEntry> cache;
+
+	ofThreadChannel<PresetSnapshot> loaded;
+};
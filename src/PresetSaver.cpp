@@ -0,0 +1,47 @@
+#include "PresetSaver.h"
+#include "GuiApp.h"
+
+//--------------------------------------------------------------
+void PresetSaver::setup(const GuiApp* guiApp) {
+	gui = guiApp;
+	startThread();
+}
+
+//--------------------------------------------------------------
+void PresetSaver::stop() {
+	// Queued saves still finish before the thread ends
+	requests.close();
+	waitForThread(false);
+	saved.close();
+}
+
+//--------------------------------------------------------------
+void PresetSaver::requestSave(const std::string& path, const std::string& name, const PresetSnapshot& snapshot) {
+	Request request;
+	request.path = path;
+	request.name = name;
+	request.snapshot = snapshot;
+	requests.send(std::move(request));
+}
+
+//--------------------------------------------------------------
+bool PresetSaver::getSaved(Result& result) {
+	return saved.tryReceive(result);
+}
+
+//--------------------------------------------------------------
+void PresetSaver::threadedFunction() {
+	Request request;
+	while (requests.receive(request)) {
+		Result result;
+		result.path = request.path;
+		result.name = request.name;
+		uint64_t start = ofGetElapsedTimeMicros();
+		result.ok = gui->writePresetFile(request.path, request.snapshot);
+		if (result.ok) {
+			ofLogNotice("Preset Saver") << "Saved " << request.path << " in "
+				<< (ofGetElapsedTimeMicros() - start) / 1000.0f << " ms";
+		}
+		saved.send(std::move(result));
+	}
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "ofMain.h"
+#include "PresetLoader.h"
+
+class GuiApp;
+
+// Writes presets on a worker thread. The GUI captures a PresetSnapshot,
+// which is only a copy of the parameter store, and the JSON and binary
+// files are built and written here. Each file goes to a temporary name
+// first and is renamed over the old one, so a preset on disk is never
+// half written.
+class PresetSaver : public ofThread {
+public:
+	struct Result {
+		std::string path;
+		std::string name;
+		bool ok = false;
+	};
+
+	void setup(const GuiApp* gui);
+	void stop();
+
+	void requestSave(const std::string& path, const std::string& name, const PresetSnapshot& snapshot);
+	// Non blocking; true for each save that finished since the last call
+	bool getSaved(Result& result);
+
+private:
+	struct Request {
+		std::string path;
+		std::string name;
+		PresetSnapshot snapshot;
+	};
+
+	void threadedFunction() override;
+
+	const GuiApp* gui = nullptr;
+	ofThreadChannel<Request> requests;
+	ofThreadChannel<Result> saved;
+};
@@ -0,0 +1,63 @@
+#include "PresetThumbnailer.h"
+#include <filesystem>
+
+//--------------------------------------------------------------
+std::string PresetThumbnailer::thumbnailPath(const std::string& presetPath) {
+	return ofFilePath::removeExt(presetPath) + ".png";
+}
+
+//--------------------------------------------------------------
+void PresetThumbnailer::setup() {
+	startThread();
+}
+
+//--------------------------------------------------------------
+void PresetThumbnailer::stop() {
+	// Queued thumbnails still get written before the thread ends
+	requests.close();
+	waitForThread(false);
+	done.close();
+}
+
+//--------------------------------------------------------------
+void PresetThumbnailer::requestWrite(const std::string& path, ofPixels&& pixels) {
+	Request request;
+	request.path = path;
+	request.pixels = std::move(pixels);
+	requests.send(std::move(request));
+}
+
+//--------------------------------------------------------------
+void PresetThumbnailer::requestRead(const std::string& path) {
+	Request request;
+	request.path = path;
+	requests.send(std::move(request));
+}
+
+//--------------------------------------------------------------
+bool PresetThumbnailer::getDone(Result& result) {
+	return done.tryReceive(result);
+}
+
+//--------------------------------------------------------------
+void PresetThumbnailer::threadedFunction() {
+	Request request;
+	while (requests.receive(request)) {
+		Result result;
+		result.path = request.path;
+		if (request.pixels.isAllocated()) {
+			// Written aside and renamed, so the GUI never decodes half a PNG
+			string tempPath = ofFilePath::removeExt(request.path) + ".tmp.png";
+			if (ofSaveImage(request.pixels, tempPath)) {
+				std::error_code error;
+				std::filesystem::rename(ofToDataPath(tempPath, true), ofToDataPath(request.path, true), error);
+				result.ok = !error;
+			}
+			if (!result.ok) ofLogError("Preset Thumbnail") << "Could not write " << request.path;
+			result.pixels = std::move(request.pixels);
+		} else {
+			result.ok = ofFile::doesFileExist(request.path) && ofLoadImage(result.pixels, request.path);
+		}
+		done.send(std::move(result));
+	}
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "ofMain.h"
+
+// Encodes and decodes preset thumbnails on a worker thread. The output
+// window reads a small downscaled frame back through a PBO and hands the
+// pixels over here to be written as a PNG next to the preset. The GUI asks
+// for thumbnails it wants to show and uploads the decoded pixels itself,
+// since the two windows do not share textures.
+class PresetThumbnailer : public ofThread {
+public:
+	struct Result {
+		std::string path;       // .png path
+		ofPixels pixels;
+		bool ok = false;
+	};
+
+	// Thumbnail of a preset, "bank/059_Preset.json" -> "bank/059_Preset.png"
+	static std::string thumbnailPath(const std::string& presetPath);
+
+	void setup();
+	void stop();
+
+	void requestWrite(const std::string& path, ofPixels&& pixels);
+	void requestRead(const std::string& path);
+	// Non blocking; every write and read that finished since the last call
+	bool getDone(Result& result);
+
+private:
+	struct Request {
+		std::string path;
+		ofPixels pixels;        // empty for a read
+	};
+
+	void threadedFunction() override;
+
+	ofThreadChannel<Request> requests;
+	ofThreadChannel<Result> done;
+};
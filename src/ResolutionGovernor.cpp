@@ -0,0 +1,62 @@
+#include "ResolutionGovernor.h"
+
+constexpr float ResolutionGovernor::SCALES[STEPS];
+
+//--------------------------------------------------------------
+void ResolutionGovernor::setup() {
+	glGenQueries(QUERIES, queries);
+}
+
+//--------------------------------------------------------------
+void ResolutionGovernor::beginFrame() {
+	cpuStart = ofGetElapsedTimeMicros();
+
+	// Collect whatever earlier frames have finished, oldest first
+	for (int i = 0; i < QUERIES; i++) {
+		int slot = (next + i) % QUERIES;
+		if (!pending[slot]) continue;
+		GLint available = 0;
+		glGetQueryObjectiv(queries[slot], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available) break;
+		GLuint64 elapsed = 0;
+		glGetQueryObjectui64v(queries[slot], GL_QUERY_RESULT, &elapsed);
+		gpuMs = ofLerp(gpuMs, elapsed / 1.0e6f, 0.1f);
+		pending[slot] = false;
+	}
+
+	// Frames too far ahead of the GPU go untimed rather than wait on it
+	timing = !pending[next];
+	if (timing) glBeginQuery(GL_TIME_ELAPSED, queries[next]);
+}
+
+//--------------------------------------------------------------
+void ResolutionGovernor::endFrame(float targetFPS, bool enabled) {
+	if (timing) {
+		glEndQuery(GL_TIME_ELAPSED);
+		pending[next] = true;
+		next = (next + 1) % QUERIES;
+	}
+	cpuMs = ofLerp(cpuMs, (ofGetElapsedTimeMicros() - cpuStart) / 1000.0f, 0.1f);
+
+	if (!enabled) {
+		step = 0;
+		return;
+	}
+	if (cooldown > 0) {
+		cooldown--;
+		return;
+	}
+
+	// GPU cost follows the render area; step up only if the larger area should still fit
+	float budgetMs = 1000.0f / std::max(targetFPS, 1.0f);
+	if (gpuMs > budgetMs * 0.9f && step < STEPS - 1) {
+		step++;
+		cooldown = COOLDOWN_FRAMES;
+	} else if (step > 0) {
+		float growth = SCALES[step - 1] / SCALES[step];
+		if (gpuMs * growth * growth < budgetMs * 0.75f) {
+			step--;
+			cooldown = COOLDOWN_FRAMES;
+		}
+	}
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "ofMain.h"
+
+// Lowers the resolution blocks 1 and 2 render at when a frame's GPU time
+// runs over the target frame rate's budget, and raises it again once there
+// is room. Only the render area changes: framebuffer1 / 2 and their
+// history stay allocated at the internal resolution and are drawn into
+// from their lower left corner, so a step never reallocates anything.
+// framebuffer3 always renders at the output resolution.
+//
+// GPU time comes from timer queries read back a few frames late, so
+// timing never stalls the pipeline. CPU time is measured too, for display;
+// the render scale can't win any of it back.
+class ResolutionGovernor {
+public:
+	static const int STEPS = 5;
+	static constexpr float SCALES[STEPS] = { 1.0f, 0.85f, 0.7f, 0.6f, 0.5f };
+
+	void setup();
+	// Start of update(), with the output window's context current
+	void beginFrame();
+	// End of draw(); steps the scale for the next frame
+	void endFrame(float targetFPS, bool enabled);
+
+	float getScale() const { return SCALES[step]; }
+	float getGpuMs() const { return gpuMs; }
+	float getCpuMs() const { return cpuMs; }
+
+private:
+	static const int QUERIES = 4;
+	static const int COOLDOWN_FRAMES = 30;     // lets the timings settle after a step
+
+	GLuint queries[QUERIES] = {};
+	bool pending[QUERIES] = {};
+	int next = 0;
+	bool timing = false;
+	uint64_t cpuStart = 0;
+
+	float gpuMs = 0;        // smoothed
+	float cpuMs = 0;        // smoothed
+	int step = 0;
+	int cooldown = 0;
+};
@@ -0,0 +1,44 @@
+#include "Upscaler.h"
+
+const char* Upscaler::modeNames[MODE_COUNT] = { "bilinear", "lanczos", "lanczos + sharpen" };
+
+//--------------------------------------------------------------
+bool Upscaler::setup(const std::string& shaderDir) {
+	loaded = shader.load(shaderDir + "/upscale");
+	if (!loaded) ofLogError("Shader") << "Upscale shader failed to load, blocks are upscaled bilinearly";
+	return loaded;
+}
+
+//--------------------------------------------------------------
+const ofTexture& Upscaler::apply(int block, const ofTexture& source, glm::vec2& scale,
+	int width, int height, const Settings& settings) {
+	if (!loaded || settings.mode == BILINEAR || !source.isAllocated()) return source;
+	// Shrinking is left to shader3's bilinear fetch
+	if (source.getWidth() * scale.x >= width && source.getHeight() * scale.y >= height) return source;
+
+	ofFbo& result = results[block];
+	if (!result.isAllocated() || result.getWidth() != width || result.getHeight() != height) {
+		ofFboSettings fboSettings;
+		fboSettings.width = width;
+		fboSettings.height = height;
+		fboSettings.internalformat = GL_RGBA8;
+		fboSettings.useDepth = false;
+		fboSettings.useStencil = false;
+		result.allocate(fboSettings);
+	}
+
+	ofPushStyle();
+	ofDisableAlphaBlending();
+	result.begin();
+	shader.begin();
+	shader.setUniform2f("sourceScale", scale);
+	shader.setUniform1i("mode", settings.mode);
+	shader.setUniform1f("sharpness", settings.sharpness);
+	source.draw(0, 0, width, height);
+	shader.end();
+	result.end();
+	ofPopStyle();
+
+	scale = glm::vec2(1.0f);
+	return result.getTexture();
+}
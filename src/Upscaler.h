@@ -0,0 +1,37 @@
+#pragma once
+
+#include "ofMain.h"
+
+// Brings blocks 1 and 2 up from their render area to the output
+// resolution ahead of shader3, with shadersGL4/upscale.frag. Lets the
+// feedback run at a fraction of the output resolution without Block 3
+// leaning on bilinear sampling for the enlargement.
+class Upscaler {
+public:
+	enum Mode {
+		BILINEAR,           // no pass, shader3 samples the block directly
+		LANCZOS,
+		LANCZOS_SHARPEN,    // plus contrast adaptive sharpening
+		MODE_COUNT
+	};
+	static const char* modeNames[MODE_COUNT];
+
+	struct Settings {
+		int mode = LANCZOS;
+		float sharpness = 0.5f;     // 0 - 1, LANCZOS_SHARPEN only
+	};
+
+	static const int BLOCKS = 2;
+
+	bool setup(const std::string& shaderDir);
+	// The lower left scale of source enlarged to width x height, with scale
+	// set to 1 to match. source itself when there is nothing to enlarge.
+	// Call outside any fbo begin / end.
+	const ofTexture& apply(int block, const ofTexture& source, glm::vec2& scale,
+		int width, int height, const Settings& settings);
+
+private:
+	ofShader shader;
+	bool loaded = false;
+	ofFbo results[BLOCKS];
+};
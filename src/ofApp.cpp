@@ -16,6 +16,8 @@ float ch2HdAspectYFix=1.0;
 const int pastFramesSize=120;
 ofFbo pastFrames1[pastFramesSize];
 ofFbo pastFrames2[pastFramesSize];
+//share of each history frame the governor rendered, see ResolutionGovernor
+glm::vec2 pastFramesScale[pastFramesSize];
 int pastFramesOffset=0;
 unsigned int pastFramesCount=0;
 
@@ -67,6 +69,7 @@ void ofApp::setup(){
 	inputSetup();
 
 	framebufferSetup();
+	thumbnailSetup();
 
 	//keep this last in setup for easier debugging
 	std::string shaderDir = "shadersGL4";
@@ -97,9 +100,18 @@ void ofApp::setup(){
 			<< " (" << glVersionStr << ")";
 	}
 	ofLogNotice("Shader") << "Using shader directory: " << shaderDir;
+	//the block shaders link side by side with the rest of setup, or come
+	//straight from the program cache; the first draw waits for them
 	shader1.load(shaderDir + "/shader1");
 	shader2.load(shaderDir + "/shader2");
 	shader3.load(shaderDir + "/shader3");
+	lissajousSetup(shaderDir);
+	generatorBatch.setup(shaderDir + "/generators");
+	particleGenerator.setup(shaderDir);
+	filterPrepass.setup(shaderDir);
+	colorizeLut.setup();
+	resolutionGovernor.setup();
+	upscaler.setup(shaderDir);
 
 	dummyTex.allocate(internalWidth, internalHeight, GL_RGBA);
 
@@ -109,6 +121,7 @@ void ofApp::setup(){
 
 //--------------------------------------------------------------
 void ofApp::update(){
+	resolutionGovernor.beginFrame();
 	processOscMessages();
 
 	// Check if video inputs need to be reinitialized
@@ -404,6 +417,12 @@ void ofApp::lfoUpdate(){
 
 }
 
+//--------------------------------------------------------------
+void ofApp::exit(){
+	cleanupNDIPBOs();
+	thumbnailCleanup();
+}
+
 //--------------------------------------------------------------
 void ofApp::draw(){
 
@@ -844,10 +863,38 @@ void ofApp::draw(){
 	//is this still used...
 	float ratio=input1.getWidth()/ofGetWidth();
 
+	int fb1DelayTimeMacroBuffer=int((pastFramesSize-1.0)*(gui->fb1DelayTimeMacroBuffer));
+	int fb1DelayTime_d=(gui->fb1DelayTime)+fb1DelayTimeMacroBuffer;
+
+	int pastFrames1Index = (abs(pastFramesOffset - pastFramesSize - (fb1DelayTime_d) + 1) % pastFramesSize);
+	int TemporalFilterIndex = (abs(pastFramesOffset - pastFramesSize + 1) % pastFramesSize);
+
+	//blocks 1 and 2 render into the lower left renderWidth x renderHeight
+	//of their buffers; framebuffer3 stays at the output resolution
+	int renderWidth=std::max(1,int(roundf(internalWidth*resolutionGovernor.getScale())));
+	int renderHeight=std::max(1,int(roundf(internalHeight*resolutionGovernor.getScale())));
+	glm::vec2 renderScale(float(renderWidth)/internalWidth,float(renderHeight)/internalHeight);
+
+	//blur and sharpen run as passes of their own, so shader1 reads
+	//ch1, ch2 and the feedback with one fetch each
+	filterPrepass.setUseCompute(gui->filterPath==1);
+	filterPrepass.beginFrame();
+	const ofTexture* ch1Tex=inputTexture(gui->ch1InputSelect);
+	if(ch1Tex){
+		ch1Tex=&filterPrepass.apply(*ch1Tex,{ch1BlurAmount,ch1BlurRadius,ch1SharpenAmount,ch1SharpenRadius,ch1FiltersBoost});
+	}
+	const ofTexture* ch2Tex=inputTexture(gui->ch2InputSelect);
+	if(ch2Tex){
+		ch2Tex=&filterPrepass.apply(*ch2Tex,{ch2BlurAmount,ch2BlurRadius,ch2SharpenAmount,ch2SharpenRadius,ch2FiltersBoost});
+	}
+	const ofTexture& fb1Tex=filterPrepass.apply(pastFrames1[pastFrames1Index].getTexture(),
+		{fb1BlurAmount,fb1BlurRadius,fb1SharpenAmount,fb1SharpenRadius,fb1FiltersBoost});
+
 	framebuffer1.begin();
 	// Explicitly set up viewport and projection for current FBO size
 	ofViewport(0, 0, framebuffer1.getWidth(), framebuffer1.getHeight());
 	ofSetupScreenOrtho(framebuffer1.getWidth(), framebuffer1.getHeight());
+	glViewport(0, 0, renderWidth, renderHeight);
 	shader1.begin();
 
 	//various test parameters to delete later
@@ -869,45 +916,18 @@ void ofApp::draw(){
 	shader1.setUniform1f("inverseHeight1",1.0f/input1Height);
 
 
-	int fb1DelayTimeMacroBuffer=int((pastFramesSize-1.0)*(gui->fb1DelayTimeMacroBuffer));
-	int fb1DelayTime_d=(gui->fb1DelayTime)+fb1DelayTimeMacroBuffer;
-
-	int pastFrames1Index = (abs(pastFramesOffset - pastFramesSize - (fb1DelayTime_d) + 1) % pastFramesSize);
-	int TemporalFilterIndex = (abs(pastFramesOffset - pastFramesSize + 1) % pastFramesSize);
-	pastFrames1[pastFrames1Index].draw(0, 0, internalWidth, internalHeight);
+	shader1.setUniform2f("fb1Scale",pastFramesScale[pastFrames1Index].x,pastFramesScale[pastFrames1Index].y);
+	shader1.setUniform2f("fb1TemporalFilterScale",pastFramesScale[TemporalFilterIndex].x,pastFramesScale[TemporalFilterIndex].y);
+	//textures are bound ahead of the draw, the pre-pass reuses texture units
 	shader1.setUniformTexture("fb1TemporalFilter", pastFrames1[TemporalFilterIndex].getTexture(), 1);
-
 	//channel selection
-	if(gui->ch1InputSelect==0){
-		// Use input1 (webcam, NDI, or Spout depending on source type)
-		if (gui->input1SourceType == 0) {
-			if (input1.isInitialized()) {
-				shader1.setUniformTexture("ch1Tex",webcamFbo1.getTexture(),2);
-			}
-		} else if (gui->input1SourceType == 1) {
-			shader1.setUniformTexture("ch1Tex",ndiFbo1.getTexture(),2);
-		} else {
-#if OFAPP_HAS_SPOUT
-			shader1.setUniformTexture("ch1Tex",spoutFbo1.getTexture(),2);
-#endif
-		}
-
+	if(ch1Tex){
+		shader1.setUniformTexture("ch1Tex",*ch1Tex,2);
 	}
-	if(gui->ch1InputSelect==1){
-		// Use input2 (webcam, NDI, or Spout depending on source type)
-		if (gui->input2SourceType == 0) {
-			if (input2.isInitialized()) {
-				shader1.setUniformTexture("ch1Tex",webcamFbo2.getTexture(),2);
-			}
-		} else if (gui->input2SourceType == 1) {
-			shader1.setUniformTexture("ch1Tex",ndiFbo2.getTexture(),2);
-		} else {
-#if OFAPP_HAS_SPOUT
-			shader1.setUniformTexture("ch1Tex",spoutFbo2.getTexture(),2);
-#endif
-		}
-
+	if(ch2Tex){
+		shader1.setUniformTexture("ch2Tex",*ch2Tex,3);
 	}
+	shader1.draw(fb1Tex, 0, 0, internalWidth, internalHeight);
 	//ch1 parameters
 
 	//we can use this to fix the uncentering of the hd version for now
@@ -971,11 +991,6 @@ void ofApp::draw(){
 	shader1.setUniform1i("ch1PosterizeSwitch",ch1PosterizeSwitch);
 	shader1.setUniform1f("ch1KaleidoscopeAmount",ch1KaleidoscopeAmount);
 	shader1.setUniform1f("ch1KaleidoscopeSlice",ch1KaleidoscopeSlice);
-	shader1.setUniform1f("ch1BlurAmount",ch1BlurAmount);
-	shader1.setUniform1f("ch1BlurRadius",ch1BlurRadius);
-	shader1.setUniform1f("ch1SharpenAmount",ch1SharpenAmount);
-	shader1.setUniform1f("ch1SharpenRadius",ch1SharpenRadius);
-	shader1.setUniform1f("ch1FiltersBoost",ch1FiltersBoost);
 
 	shader1.setUniform1i("ch1GeoOverflow",gui->ch1GeoOverflow);
 	shader1.setUniform1i("ch1HMirror",gui->ch1HMirror);
@@ -992,35 +1007,6 @@ void ofApp::draw(){
 
 
 
-	//channel selection
-	if(gui->ch2InputSelect==0){
-		// Use input1 (webcam, NDI, or Spout depending on source type)
-		if (gui->input1SourceType == 0) {
-			if (input1.isInitialized()) {
-				shader1.setUniformTexture("ch2Tex",webcamFbo1.getTexture(),3);
-			}
-		} else if (gui->input1SourceType == 1) {
-			shader1.setUniformTexture("ch2Tex",ndiFbo1.getTexture(),3);
-		} else {
-#if OFAPP_HAS_SPOUT
-			shader1.setUniformTexture("ch2Tex",spoutFbo1.getTexture(),3);
-#endif
-		}
-	}
-	if(gui->ch2InputSelect==1){
-		// Use input2 (webcam, NDI, or Spout depending on source type)
-		if (gui->input2SourceType == 0) {
-			if (input2.isInitialized()) {
-				shader1.setUniformTexture("ch2Tex",webcamFbo2.getTexture(),3);
-			}
-		} else if (gui->input2SourceType == 1) {
-			shader1.setUniformTexture("ch2Tex",ndiFbo2.getTexture(),3);
-		} else {
-#if OFAPP_HAS_SPOUT
-			shader1.setUniformTexture("ch2Tex",spoutFbo2.getTexture(),3);
-#endif
-		}
-	}
 
 
 	//we ADD a logic here for sd pillarbox vs sd fullscreen?
@@ -1085,11 +1071,6 @@ void ofApp::draw(){
 	shader1.setUniform1i("ch2PosterizeSwitch",ch2PosterizeSwitch);
 	shader1.setUniform1f("ch2KaleidoscopeAmount",ch2KaleidoscopeAmount);
 	shader1.setUniform1f("ch2KaleidoscopeSlice",ch2KaleidoscopeSlice);
-	shader1.setUniform1f("ch2BlurAmount",ch2BlurAmount);
-	shader1.setUniform1f("ch2BlurRadius",ch2BlurRadius);
-	shader1.setUniform1f("ch2SharpenAmount",ch2SharpenAmount);
-	shader1.setUniform1f("ch2SharpenRadius",ch2SharpenRadius);
-	shader1.setUniform1f("ch2FiltersBoost",ch2FiltersBoost);
 
 	shader1.setUniform1i("ch2GeoOverflow",gui->ch2GeoOverflow);
 	shader1.setUniform1i("ch2HMirror",gui->ch2HMirror);
@@ -1145,15 +1126,10 @@ void ofApp::draw(){
 
 
 	//fb1 filters
-	shader1.setUniform1f("fb1BlurAmount",fb1BlurAmount);
-	shader1.setUniform1f("fb1BlurRadius",fb1BlurRadius);
-	shader1.setUniform1f("fb1SharpenAmount",fb1SharpenAmount);
-	shader1.setUniform1f("fb1SharpenRadius",fb1SharpenRadius);
 	shader1.setUniform1f("fb1TemporalFilter1Amount",fb1TemporalFilter1Amount);
 	shader1.setUniform1f("fb1TemporalFilter1Resonance",fb1TemporalFilter1Resonance);
 	shader1.setUniform1f("fb1TemporalFilter2Amount",fb1TemporalFilter2Amount);
 	shader1.setUniform1f("fb1TemporalFilter2Resonance",fb1TemporalFilter2Resonance);
-	shader1.setUniform1f("fb1FiltersBoost",fb1FiltersBoost);
 
 
 	shader1.end();
@@ -1166,6 +1142,9 @@ void ofApp::draw(){
         ofSetupScreenPerspective(framebuffer1.getWidth(), framebuffer1.getHeight());
     }
 
+    // Line, seven star, lissaball and hypercube all go out in one draw
+    generatorBatch.begin();
+
     if(gui->block1LineSwitch==1){
     	line_draw();
     }
@@ -1178,8 +1157,14 @@ void ofApp::draw(){
     if(gui->block1HypercubeSwitch==1){
         hypercube_draw();
     }
+    generatorBatch.draw();
     if(gui->block1LissajousCurveSwitch==1){
         lissajousCurve1Draw();
+    }
+    // Particles follow the previous frame, the one a delay time of 1 reads
+    if(gui->block1ParticlesSwitch==1){
+        int previousIndex=(pastFramesSize - pastFramesOffset) % pastFramesSize;
+        particlesDraw(0, pastFrames1[previousIndex].getTexture(), pastFramesScale[previousIndex]);
     }
 	framebuffer1.end();
 
@@ -1266,10 +1251,24 @@ void ofApp::draw(){
 
 	//BLOCK_2
 
+	int fb2DelayTimeMacroBuffer=int((pastFramesSize-1.0)*(gui->fb2DelayTimeMacroBuffer));
+	int fb2DelayTime_d=(gui->fb2DelayTime)+fb2DelayTimeMacroBuffer;
+	int pastFrames2Index =  (abs(pastFramesOffset - pastFramesSize - (fb2DelayTime_d) + 1) % pastFramesSize);
+
+	//block2 input and fb2 are blurred and sharpened ahead of shader2
+	const ofTexture* block2InputTex=gui->block2InputSelect==0 ? &framebuffer1.getTexture() : inputTexture(gui->block2InputSelect-1);
+	if(block2InputTex){
+		block2InputTex=&filterPrepass.apply(*block2InputTex,
+			{block2InputBlurAmount,block2InputBlurRadius,block2InputSharpenAmount,block2InputSharpenRadius,block2InputFiltersBoost});
+	}
+	const ofTexture& fb2Tex=filterPrepass.apply(pastFrames2[pastFrames2Index].getTexture(),
+		{fb2BlurAmount,fb2BlurRadius,fb2SharpenAmount,fb2SharpenRadius,fb2FiltersBoost});
+
 	framebuffer2.begin();
 	// Explicitly set up viewport and projection for current FBO size
 	ofViewport(0, 0, framebuffer2.getWidth(), framebuffer2.getHeight());
 	ofSetupScreenOrtho(framebuffer2.getWidth(), framebuffer2.getHeight());
+	glViewport(0, 0, renderWidth, renderHeight);
 	shader2.begin();
 
 	shader2.setUniform1f("width",internalWidth);
@@ -1283,15 +1282,20 @@ void ofApp::draw(){
 	shader2.setUniform1f("inverseWidth1",1.0f/input1Width);
 	shader2.setUniform1f("inverseHeight1",1.0f/input1Height);
 
-	int fb2DelayTimeMacroBuffer=int((pastFramesSize-1.0)*(gui->fb2DelayTimeMacroBuffer));
-	int fb2DelayTime_d=(gui->fb2DelayTime)+fb2DelayTimeMacroBuffer;
-
-	//draw pastframes2
-	int pastFrames2Index =  (abs(pastFramesOffset - pastFramesSize - (fb2DelayTime_d) + 1) % pastFramesSize);
-	pastFrames2[pastFrames2Index].draw(0, 0, internalWidth, internalHeight);
-	//send the temporal filter
 	int fb2TemporalFilterIndex = (abs(pastFramesOffset - pastFramesSize + 1) % pastFramesSize);
+	glm::vec2 block2InputScale=gui->block2InputSelect==0 ? renderScale : glm::vec2(1.0f);
+	shader2.setUniform2f("block2InputScale",block2InputScale.x,block2InputScale.y);
+	shader2.setUniform2f("fb2Scale",pastFramesScale[pastFrames2Index].x,pastFramesScale[pastFrames2Index].y);
+	shader2.setUniform2f("fb2TemporalFilterScale",pastFramesScale[fb2TemporalFilterIndex].x,pastFramesScale[fb2TemporalFilterIndex].y);
+
+	//send the temporal filter and block2 input ahead of the draw, the
+	//pre-pass reuses texture units
 	shader2.setUniformTexture("fb2TemporalFilter", pastFrames2[fb2TemporalFilterIndex].getTexture(), 5);
+	if(block2InputTex){
+		shader2.setUniformTexture("block2InputTex",*block2InputTex,6);
+	}
+	//draw pastframes2
+	shader2.draw(fb2Tex, 0, 0, internalWidth, internalHeight);
 
 	bool block2InputMasterSwitch=0;
 	float block2InputWidth=internalWidth;
@@ -1302,44 +1306,17 @@ void ofApp::draw(){
 	float block2AspectRatio=1.0;
 	if(gui->block2InputSelect==0){
 		ratio=1.0;
-		shader2.setUniformTexture("block2InputTex",framebuffer1.getTexture(),6);
-
 	}
 
 	if(gui->block2InputSelect==1){
 		ratio=input1.getWidth()/ofGetWidth();
 		block2InputMasterSwitch=1;
-		// Use input1 (webcam, NDI, or Spout depending on source type)
-		if (gui->input1SourceType == 0) {
-			if (input1.isInitialized()) {
-				shader2.setUniformTexture("block2InputTex",webcamFbo1.getTexture(),6);
-			}
-		} else if (gui->input1SourceType == 1) {
-			shader2.setUniformTexture("block2InputTex",ndiFbo1.getTexture(),6);
-		} else {
-#if OFAPP_HAS_SPOUT
-			shader2.setUniformTexture("block2InputTex",spoutFbo1.getTexture(),6);
-#endif
-		}
 		// Inputs are now pre-scaled to internal resolution
-
 	}
 
 	if(gui->block2InputSelect==2){
 		ratio=input2.getWidth()/ofGetWidth();
 		block2InputMasterSwitch=1;
-		// Use input2 (webcam, NDI, or Spout depending on source type)
-		if (gui->input2SourceType == 0) {
-			if (input2.isInitialized()) {
-				shader2.setUniformTexture("block2InputTex",webcamFbo2.getTexture(),6);
-			}
-		} else if (gui->input2SourceType == 1) {
-			shader2.setUniformTexture("block2InputTex",ndiFbo2.getTexture(),6);
-		} else {
-#if OFAPP_HAS_SPOUT
-			shader2.setUniformTexture("block2InputTex",spoutFbo2.getTexture(),6);
-#endif
-		}
 		// Inputs are now pre-scaled to internal resolution
 	}
 
@@ -1399,11 +1376,6 @@ void ofApp::draw(){
 	shader2.setUniform1i("block2InputPosterizeSwitch",block2InputPosterizeSwitch);
 	shader2.setUniform1f("block2InputKaleidoscopeAmount",block2InputKaleidoscopeAmount);
 	shader2.setUniform1f("block2InputKaleidoscopeSlice",block2InputKaleidoscopeSlice);
-	shader2.setUniform1f("block2InputBlurAmount",block2InputBlurAmount);
-	shader2.setUniform1f("block2InputBlurRadius",block2InputBlurRadius);
-	shader2.setUniform1f("block2InputSharpenAmount",block2InputSharpenAmount);
-	shader2.setUniform1f("block2InputSharpenRadius",block2InputSharpenRadius);
-	shader2.setUniform1f("block2InputFiltersBoost",block2InputFiltersBoost);
 
 	shader2.setUniform1i("block2InputGeoOverflow",gui->block2InputGeoOverflow);
 	shader2.setUniform1i("block2InputHMirror",gui->block2InputHMirror);
@@ -1458,15 +1430,10 @@ void ofApp::draw(){
 
 
 	//fb2 filters
-	shader2.setUniform1f("fb2BlurAmount",fb2BlurAmount);
-	shader2.setUniform1f("fb2BlurRadius",fb2BlurRadius);
-	shader2.setUniform1f("fb2SharpenAmount",fb2SharpenAmount);
-	shader2.setUniform1f("fb2SharpenRadius",fb2SharpenRadius);
 	shader2.setUniform1f("fb2TemporalFilter1Amount",fb2TemporalFilter1Amount);
 	shader2.setUniform1f("fb2TemporalFilter1Resonance",fb2TemporalFilter1Resonance);
 	shader2.setUniform1f("fb2TemporalFilter2Amount",fb2TemporalFilter2Amount);
 	shader2.setUniform1f("fb2TemporalFilter2Resonance",fb2TemporalFilter2Resonance);
-	shader2.setUniform1f("fb2FiltersBoost",fb2FiltersBoost);
 
 
 	shader2.end();
@@ -1479,6 +1446,9 @@ void ofApp::draw(){
         ofSetupScreenPerspective(framebuffer2.getWidth(), framebuffer2.getHeight());
     }
 
+    // Line, seven star, lissaball and hypercube all go out in one draw
+    generatorBatch.begin();
+
     if(gui->block2LineSwitch==1){
     	line_draw();
     }
@@ -1491,8 +1461,14 @@ void ofApp::draw(){
 	if(gui->block2HypercubeSwitch==1){
         hypercube_draw();
     }
+    generatorBatch.draw();
     if(gui->block2LissajousCurveSwitch==1){
         lissajousCurve2Draw();
+    }
+    // Particles follow the previous frame, the one a delay time of 1 reads
+    if(gui->block2ParticlesSwitch==1){
+        int previousIndex=(pastFramesSize - pastFramesOffset) % pastFramesSize;
+        particlesDraw(1, pastFrames2[previousIndex].getTexture(), pastFramesScale[previousIndex]);
     }
 	framebuffer2.end();
 
@@ -1583,15 +1559,32 @@ void ofApp::draw(){
 
 
 	//FINAL MIX OUT
+
+	//both blocks are blurred and sharpened ahead of shader3, then brought
+	//up to the output resolution
+	const ofTexture& block1Filtered=filterPrepass.apply(framebuffer1.getTexture(),
+		{block1BlurAmount,block1BlurRadius,block1SharpenAmount,block1SharpenRadius,block1FiltersBoost});
+	const ofTexture& block2Filtered=filterPrepass.apply(framebuffer2.getTexture(),
+		{block2BlurAmount,block2BlurRadius,block2SharpenAmount,block2SharpenRadius,block2FiltersBoost});
+	Upscaler::Settings upscale;
+	upscale.mode=gui->upscaleMode;
+	upscale.sharpness=gui->upscaleSharpness;
+	glm::vec2 block1Scale=renderScale;
+	glm::vec2 block2Scale=renderScale;
+	const ofTexture& block1Tex=upscaler.apply(0,block1Filtered,block1Scale,framebuffer3.getWidth(),framebuffer3.getHeight(),upscale);
+	const ofTexture& block2Tex=upscaler.apply(1,block2Filtered,block2Scale,framebuffer3.getWidth(),framebuffer3.getHeight(),upscale);
+
 	framebuffer3.begin();
 	// Explicitly set up viewport and projection for current FBO size
 	ofViewport(0, 0, framebuffer3.getWidth(), framebuffer3.getHeight());
 	ofSetupScreenOrtho(framebuffer3.getWidth(), framebuffer3.getHeight());
 	shader3.begin();
-	dummyTex.draw(0, 0, framebuffer3.getWidth(), framebuffer3.getHeight());
-
-	shader3.setUniformTexture("block2Output",framebuffer2.getTexture(),8);
-	shader3.setUniformTexture("block1Output",framebuffer1.getTexture(),9);
+	shader3.setUniform2f("block1Scale",block1Scale.x,block1Scale.y);
+	shader3.setUniform2f("block2Scale",block2Scale.x,block2Scale.y);
+	//bound ahead of the draw, the pre-pass reuses texture units
+	shader3.setUniformTexture("block2Output",block2Tex,8);
+	shader3.setUniformTexture("block1Output",block1Tex,9);
+	shader3.draw(dummyTex, 0, 0, framebuffer3.getWidth(), framebuffer3.getHeight());
 
 	shader3.setUniform1f("width",internalWidth);
 	shader3.setUniform1f("height",internalHeight);
@@ -1624,23 +1617,19 @@ void ofApp::draw(){
 	shader3.setUniform1i("block1ColorizeSwitch",gui->block1ColorizeSwitch);
 	shader3.setUniform1i("block1ColorizeHSB_RGB",gui->block1ColorizeHSB_RGB);
 
-	shader3.setUniform3f("block1ColorizeBand1",block1ColorizeHueBand1,
-				block1ColorizeSaturationBand1,block1ColorizeBrightBand1);
-	shader3.setUniform3f("block1ColorizeBand2",block1ColorizeHueBand2,
-				block1ColorizeSaturationBand2,block1ColorizeBrightBand2);
-	shader3.setUniform3f("block1ColorizeBand3",block1ColorizeHueBand3,
-				block1ColorizeSaturationBand3,block1ColorizeBrightBand3);
-	shader3.setUniform3f("block1ColorizeBand4",block1ColorizeHueBand4,
-				block1ColorizeSaturationBand4,block1ColorizeBrightBand4);
-	shader3.setUniform3f("block1ColorizeBand5",block1ColorizeHueBand5,
-				block1ColorizeSaturationBand5,block1ColorizeBrightBand5);
+	//the bands only reach shader3 through the baked table
+	if(gui->block1ColorizeSwitch){
+		ColorizeLut::Settings block1Colorize;
+		block1Colorize.bands[0]=glm::vec3(block1ColorizeHueBand1,block1ColorizeSaturationBand1,block1ColorizeBrightBand1);
+		block1Colorize.bands[1]=glm::vec3(block1ColorizeHueBand2,block1ColorizeSaturationBand2,block1ColorizeBrightBand2);
+		block1Colorize.bands[2]=glm::vec3(block1ColorizeHueBand3,block1ColorizeSaturationBand3,block1ColorizeBrightBand3);
+		block1Colorize.bands[3]=glm::vec3(block1ColorizeHueBand4,block1ColorizeSaturationBand4,block1ColorizeBrightBand4);
+		block1Colorize.bands[4]=glm::vec3(block1ColorizeHueBand5,block1ColorizeSaturationBand5,block1ColorizeBrightBand5);
+		block1Colorize.hsb=gui->block1ColorizeHSB_RGB==0;
+		shader3.setUniformTexture("block1ColorizeLut",colorizeLut.update(0,block1Colorize),10);
+	}
 
 	//block1 filters
-	shader3.setUniform1f("block1BlurAmount",block1BlurAmount);
-	shader3.setUniform1f("block1BlurRadius",block1BlurRadius);
-	shader3.setUniform1f("block1SharpenAmount",block1SharpenAmount);
-	shader3.setUniform1f("block1SharpenRadius",block1SharpenRadius);
-	shader3.setUniform1f("block1FiltersBoost",block1FiltersBoost);
 	shader3.setUniform1f("block1Dither",block1Dither);
 	bool block1DitherSwitch=0;
 	if(gui->block1Filters[5] >0){block1DitherSwitch=1;}
@@ -1674,23 +1663,19 @@ void ofApp::draw(){
 	shader3.setUniform1i("block2ColorizeSwitch",gui->block2ColorizeSwitch);
 	shader3.setUniform1i("block2ColorizeHSB_RGB",gui->block2ColorizeHSB_RGB);
 
-	shader3.setUniform3f("block2ColorizeBand1",block2ColorizeHueBand1,
-				block2ColorizeSaturationBand1,block2ColorizeBrightBand1);
-	shader3.setUniform3f("block2ColorizeBand2",block2ColorizeHueBand2,
-				block2ColorizeSaturationBand2,block2ColorizeBrightBand2);
-	shader3.setUniform3f("block2ColorizeBand3",block2ColorizeHueBand3,
-				block2ColorizeSaturationBand3,block2ColorizeBrightBand3);
-	shader3.setUniform3f("block2ColorizeBand4",block2ColorizeHueBand4,
-				block2ColorizeSaturationBand4,block2ColorizeBrightBand4);
-	shader3.setUniform3f("block2ColorizeBand5",block2ColorizeHueBand5,
-				block2ColorizeSaturationBand5,block2ColorizeBrightBand5);
+	//the bands only reach shader3 through the baked table
+	if(gui->block2ColorizeSwitch){
+		ColorizeLut::Settings block2Colorize;
+		block2Colorize.bands[0]=glm::vec3(block2ColorizeHueBand1,block2ColorizeSaturationBand1,block2ColorizeBrightBand1);
+		block2Colorize.bands[1]=glm::vec3(block2ColorizeHueBand2,block2ColorizeSaturationBand2,block2ColorizeBrightBand2);
+		block2Colorize.bands[2]=glm::vec3(block2ColorizeHueBand3,block2ColorizeSaturationBand3,block2ColorizeBrightBand3);
+		block2Colorize.bands[3]=glm::vec3(block2ColorizeHueBand4,block2ColorizeSaturationBand4,block2ColorizeBrightBand4);
+		block2Colorize.bands[4]=glm::vec3(block2ColorizeHueBand5,block2ColorizeSaturationBand5,block2ColorizeBrightBand5);
+		block2Colorize.hsb=gui->block2ColorizeHSB_RGB==0;
+		shader3.setUniformTexture("block2ColorizeLut",colorizeLut.update(1,block2Colorize),11);
+	}
 
 	//block2 filters
-	shader3.setUniform1f("block2BlurAmount",block2BlurAmount);
-	shader3.setUniform1f("block2BlurRadius",block2BlurRadius);
-	shader3.setUniform1f("block2SharpenAmount",block2SharpenAmount);
-	shader3.setUniform1f("block2SharpenRadius",block2SharpenRadius);
-	shader3.setUniform1f("block2FiltersBoost",block2FiltersBoost);
 	shader3.setUniform1f("block2Dither",block2Dither);
 	bool block2DitherSwitch=0;
 	if(gui->block2Filters[5] >0){block2DitherSwitch=1;}
@@ -1742,6 +1727,8 @@ void ofApp::draw(){
 	shader3.end();
 	framebuffer3.end();
 
+	thumbnailUpdate();
+
 #if OFAPP_HAS_SPOUT
 	// Spout send for Block 3 (final output)
 	if(gui->spoutSendBlock3){
@@ -1808,21 +1795,24 @@ void ofApp::draw(){
 	ofSetupScreen();
 
 	if(gui->drawMode==0){
-		framebuffer1.draw(0, 0, ofGetWidth(), ofGetHeight());
+		framebuffer1.getTexture().drawSubsection(0, 0, ofGetWidth(), ofGetHeight(), 0, 0, renderWidth, renderHeight);
 	}
 	else if(gui->drawMode==1){
-		framebuffer2.draw(0, 0, ofGetWidth(), ofGetHeight());
+		framebuffer2.getTexture().drawSubsection(0, 0, ofGetWidth(), ofGetHeight(), 0, 0, renderWidth, renderHeight);
 	}
 	else if(gui->drawMode==2){
 		framebuffer3.draw(0, 0, ofGetWidth(), ofGetHeight());
 	}
 	else if(gui->drawMode==3){
-		framebuffer1.draw(0, 0, ofGetWidth() / 2, ofGetHeight() / 2);
-		framebuffer2.draw(ofGetWidth() / 2, 0, ofGetWidth() / 2, ofGetHeight() / 2);
+		framebuffer1.getTexture().drawSubsection(0, 0, ofGetWidth() / 2, ofGetHeight() / 2, 0, 0, renderWidth, renderHeight);
+		framebuffer2.getTexture().drawSubsection(ofGetWidth() / 2, 0, ofGetWidth() / 2, ofGetHeight() / 2, 0, 0, renderWidth, renderHeight);
 		framebuffer3.draw(0,ofGetHeight()/2,ofGetWidth()/2, ofGetHeight()/2);
 	}
 
 
+	//only the rendered area is copied into the history, and its scale kept with it
+	glEnable(GL_SCISSOR_TEST);
+	glScissor(0, 0, renderWidth, renderHeight);
 	pastFrames1[pastFramesSize - pastFramesOffset - 1].begin();
 	framebuffer1.draw(0, 0, internalWidth, internalHeight);
 	pastFrames1[pastFramesSize - pastFramesOffset - 1].end();
@@ -1830,6 +1820,8 @@ void ofApp::draw(){
 	pastFrames2[pastFramesSize - pastFramesOffset - 1].begin();
     framebuffer2.draw(0, 0, internalWidth, internalHeight);
     pastFrames2[pastFramesSize - pastFramesOffset - 1].end();
+	glDisable(GL_SCISSOR_TEST);
+	pastFramesScale[pastFramesSize - pastFramesOffset - 1]=renderScale;
 
 	pastFramesOffset++;
     pastFramesOffset=pastFramesOffset % pastFramesSize;
@@ -1870,6 +1862,8 @@ void ofApp::draw(){
 	pboIndex = (pboIndex + 1) % 2;
 	pboNextIndex = (pboNextIndex + 1) % 2;
 	ndiFrameCount++;  // Increment to start sending after first frame
+
+	resolutionGovernor.endFrame(gui->targetFPS, gui->resolutionGovernor);
 }
 
 
@@ -2106,6 +2100,24 @@ void ofApp::inputUpdate(){
 }
 
 
+//--------------------------------------------------------------
+const ofTexture* ofApp::inputTexture(int input){
+	if(input!=0 && input!=1) return nullptr;
+	int sourceType=input==0 ? gui->input1SourceType : gui->input2SourceType;
+	if(sourceType==0){
+		ofVideoGrabber& grabber=input==0 ? input1 : input2;
+		if(!grabber.isInitialized()) return nullptr;
+		return &(input==0 ? webcamFbo1 : webcamFbo2).getTexture();
+	}
+	if(sourceType==1){
+		return &(input==0 ? ndiFbo1 : ndiFbo2).getTexture();
+	}
+#if OFAPP_HAS_SPOUT
+	return &(input==0 ? spoutFbo1 : spoutFbo2).getTexture();
+#else
+	return nullptr;
+#endif
+}
 //--------------------------------------------------------------
 void ofApp::inputTest(){
 
@@ -2302,10 +2314,98 @@ void ofApp::framebufferSetup(){
 	for(int i=0;i<pastFramesSize;i++){
         allocateGpuOnlyFbo(pastFrames1[i], internalWidth, internalHeight);
         allocateGpuOnlyFbo(pastFrames2[i], internalWidth, internalHeight);
+        pastFramesScale[i]=glm::vec2(1.0f);
     }
 
 }
 
+//--------------------------------------------------------------
+void ofApp::thumbnailSetup(){
+	allocateGpuOnlyFbo(thumbnailFbo, thumbnailWidth, thumbnailHeight);
+
+	glGenBuffers(2, thumbnailPbo);
+	for (int i = 0; i < 2; i++) {
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, thumbnailPbo[i]);
+		glBufferData(GL_PIXEL_PACK_BUFFER, thumbnailWidth * thumbnailHeight * 4, NULL, GL_STREAM_READ);
+	}
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+//--------------------------------------------------------------
+void ofApp::thumbnailCleanup(){
+	// Captures still in flight are dropped with their buffers
+	for (int i = 0; i < 2; i++) {
+		if (thumbnailFence[i]) {
+			glDeleteSync(thumbnailFence[i]);
+			thumbnailFence[i] = nullptr;
+		}
+	}
+	glDeleteBuffers(2, thumbnailPbo);
+}
+
+//--------------------------------------------------------------
+void ofApp::captureThumbnail(const std::string& path, int delayFrames){
+	thumbnailPendingPath = path;
+	thumbnailPendingFrames = delayFrames;
+}
+
+//--------------------------------------------------------------
+void ofApp::thumbnailUpdate(){
+	// Readbacks whose fence has signalled go to the encoder thread; the
+	// others are looked at again next frame
+	for (int i = 0; i < 2; i++) {
+		if (!thumbnailFence[i]) continue;
+		GLenum status = glClientWaitSync(thumbnailFence[i], 0, 0);
+		if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) continue;
+		glDeleteSync(thumbnailFence[i]);
+		thumbnailFence[i] = nullptr;
+
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, thumbnailPbo[i]);
+		GLubyte* ptr = (GLubyte*)glMapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+		if (ptr) {
+			ofPixels pixels;
+			pixels.setFromPixels(ptr, thumbnailWidth, thumbnailHeight, OF_PIXELS_RGBA);
+			glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+			gui->presetThumbnailer.requestWrite(thumbnailReadPath[i], std::move(pixels));
+		}
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	}
+
+	if (thumbnailPendingPath.empty()) return;
+	if (thumbnailPendingFrames > 0) {
+		thumbnailPendingFrames--;
+		return;
+	}
+	int slot = !thumbnailFence[0] ? 0 : (!thumbnailFence[1] ? 1 : -1);
+	if (slot < 0) return;  // both readbacks still in flight
+
+	// Sample the output through its mip chain so the reduction averages
+	// instead of skipping pixels; only done on the frame that is captured
+	const ofTextureData& output = framebuffer3.getTexture().getTextureData();
+	glBindTexture(output.textureTarget, output.textureID);
+	glGenerateMipmap(output.textureTarget);
+	glTexParameteri(output.textureTarget, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+	glBindTexture(output.textureTarget, 0);
+
+	thumbnailFbo.begin();
+	ofClear(0, 0, 0, 255);
+	framebuffer3.draw(0, 0, thumbnailWidth, thumbnailHeight);
+	thumbnailFbo.end();
+
+	glBindTexture(output.textureTarget, output.textureID);
+	glTexParameteri(output.textureTarget, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+	glBindTexture(output.textureTarget, 0);
+
+	thumbnailFbo.bind();
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, thumbnailPbo[slot]);
+	glReadPixels(0, 0, thumbnailWidth, thumbnailHeight, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+	glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+	thumbnailFbo.unbind();
+	thumbnailFence[slot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	thumbnailReadPath[slot] = thumbnailPendingPath;
+	thumbnailPendingPath.clear();
+}
+
 //--------------------------------------------------------------
 void ofApp::reinitializeResolutions(){
 	ofLogNotice("Resolution") << "Reinitializing resolutions:";
@@ -2349,6 +2449,7 @@ void ofApp::reinitializeResolutions(){
 	for(int i=0; i<pastFramesSize; i++){
 		allocateGpuOnlyFbo(pastFrames1[i], internalWidth, internalHeight);
 		allocateGpuOnlyFbo(pastFrames2[i], internalWidth, internalHeight);
+		pastFramesScale[i]=glm::vec2(1.0f);
 	}
 
 	// Reallocate NDI input FBOs at INTERNAL resolution - GPU-only
@@ -2483,9 +2584,9 @@ void ofApp::line_draw(){
 	ofRotateXRad(line_eta);
 	ofRotateYRad(line_phi);
 
-	ofSetColor( 180.0f+63.0f*( sin(line_eta) ),127.0f+127.0f*( sin(line_theta) ),180.0f+63.0f*( sin(line_phi) ) );
+	generatorBatch.setColor(ofColor( 180.0f+63.0f*( sin(line_eta) ),127.0f+127.0f*( sin(line_theta) ),180.0f+63.0f*( sin(line_phi) ) ));
 
-	ofDrawLine(linePosition1,linePosition2);
+	generatorBatch.addLine(linePosition1,linePosition2);
 	ofPopMatrix();
 }
 
@@ -2532,8 +2633,7 @@ void ofApp::hypercube_draw(){
 
 
         hypercube_color_theta+=.01;
-        ofSetColor(127+127*sin(hypercube_color_theta),0+192*abs(cos(hypercube_color_theta*.2)),127+127*cos(hypercube_color_theta/3.0f));
-        ofNoFill();
+        generatorBatch.setColor(ofColor(127+127*sin(hypercube_color_theta),0+192*abs(cos(hypercube_color_theta*.2)),127+127*cos(hypercube_color_theta/3.0f)));
         ofPushMatrix();
         ofTranslate(outputWidth/2,outputHeight/2);
         ofRotateYRad(-PI/2);
@@ -2546,47 +2646,46 @@ void ofApp::hypercube_draw(){
         //i think just pick like an inner cube and an outer cube
         //if thats even possible
 
-        ofDrawLine(hypercube_x[0],hypercube_y[0],hypercube_z[0],hypercube_x[1],hypercube_y[1],hypercube_z[1]);
-        ofDrawLine(hypercube_x[1],hypercube_y[1],hypercube_z[1],hypercube_x[2],hypercube_y[2],hypercube_z[2]);
-        ofDrawLine(hypercube_x[2],hypercube_y[2],hypercube_z[2],hypercube_x[3],hypercube_y[3],hypercube_z[3]);
-        ofDrawLine(hypercube_x[3],hypercube_y[3],hypercube_z[3],hypercube_x[4],hypercube_y[4],hypercube_z[4]);
-        ofDrawLine(hypercube_x[4],hypercube_y[4],hypercube_z[4],hypercube_x[5],hypercube_y[5],hypercube_z[5]);
-        ofDrawLine(hypercube_x[5],hypercube_y[5],hypercube_z[5],hypercube_x[6],hypercube_y[6],hypercube_z[6]);
-        ofDrawLine(hypercube_x[6],hypercube_y[6],hypercube_z[6],hypercube_x[7],hypercube_y[7],hypercube_z[7]);
-        ofDrawLine(hypercube_x[7],hypercube_y[7],hypercube_z[7],hypercube_x[0],hypercube_y[0],hypercube_z[0]);
-
-        ofDrawLine(hypercube_x[0],hypercube_y[0],-hypercube_z[0],hypercube_x[1],hypercube_y[1],-hypercube_z[1]);
-        ofDrawLine(hypercube_x[1],hypercube_y[1],-hypercube_z[1],hypercube_x[2],hypercube_y[2],-hypercube_z[2]);
-        ofDrawLine(hypercube_x[2],hypercube_y[2],-hypercube_z[2],hypercube_x[3],hypercube_y[3],-hypercube_z[3]);
-        ofDrawLine(hypercube_x[3],hypercube_y[3],-hypercube_z[3],hypercube_x[4],hypercube_y[4],-hypercube_z[4]);
-        ofDrawLine(hypercube_x[4],hypercube_y[4],-hypercube_z[4],hypercube_x[5],hypercube_y[5],-hypercube_z[5]);
-        ofDrawLine(hypercube_x[5],hypercube_y[5],-hypercube_z[5],hypercube_x[6],hypercube_y[6],-hypercube_z[6]);
-        ofDrawLine(hypercube_x[6],hypercube_y[6],-hypercube_z[6],hypercube_x[7],hypercube_y[7],-hypercube_z[7]);
-        ofDrawLine(hypercube_x[7],hypercube_y[7],-hypercube_z[7],hypercube_x[0],hypercube_y[0],-hypercube_z[0]);
-
-        ofDrawLine(hypercube_x[0],hypercube_y[0],hypercube_z[0],hypercube_x[0],hypercube_y[0],-hypercube_z[0]);
-        ofDrawLine(hypercube_x[1],hypercube_y[1],hypercube_z[1],hypercube_x[1],hypercube_y[1],-hypercube_z[1]);
-        ofDrawLine(hypercube_x[2],hypercube_y[2],hypercube_z[2],hypercube_x[2],hypercube_y[2],-hypercube_z[2]);
-        ofDrawLine(hypercube_x[3],hypercube_y[3],hypercube_z[3],hypercube_x[3],hypercube_y[3],-hypercube_z[3]);
-        ofDrawLine(hypercube_x[4],hypercube_y[4],hypercube_z[4],hypercube_x[4],hypercube_y[4],-hypercube_z[4]);
-        ofDrawLine(hypercube_x[5],hypercube_y[5],hypercube_z[5],hypercube_x[5],hypercube_y[5],-hypercube_z[5]);
-        ofDrawLine(hypercube_x[6],hypercube_y[6],hypercube_z[6],hypercube_x[6],hypercube_y[6],-hypercube_z[6]);
-        ofDrawLine(hypercube_x[7],hypercube_y[7],hypercube_z[7],hypercube_x[7],hypercube_y[7],-hypercube_z[7]);
-
-        ofDrawLine(hypercube_x[0],hypercube_y[0],-hypercube_z[0],hypercube_x[4],hypercube_y[4],-hypercube_z[4]);
-        ofDrawLine(hypercube_x[1],hypercube_y[1],-hypercube_z[1],hypercube_x[5],hypercube_y[5],-hypercube_z[5]);
-        ofDrawLine(hypercube_x[2],hypercube_y[2],-hypercube_z[2],hypercube_x[6],hypercube_y[6],-hypercube_z[6]);
-        ofDrawLine(hypercube_x[3],hypercube_y[3],-hypercube_z[3],hypercube_x[7],hypercube_y[7],-hypercube_z[7]);
-
-        ofDrawLine(hypercube_x[0],hypercube_y[0],hypercube_z[0],hypercube_x[4],hypercube_y[4],hypercube_z[4]);
-        ofDrawLine(hypercube_x[1],hypercube_y[1],hypercube_z[1],hypercube_x[5],hypercube_y[5],hypercube_z[5]);
-        ofDrawLine(hypercube_x[2],hypercube_y[2],hypercube_z[2],hypercube_x[6],hypercube_y[6],hypercube_z[6]);
-        ofDrawLine(hypercube_x[3],hypercube_y[3],hypercube_z[3],hypercube_x[7],hypercube_y[7],hypercube_z[7]);
+        generatorBatch.addLine(glm::vec3(hypercube_x[0],hypercube_y[0],hypercube_z[0]),glm::vec3(hypercube_x[1],hypercube_y[1],hypercube_z[1]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[1],hypercube_y[1],hypercube_z[1]),glm::vec3(hypercube_x[2],hypercube_y[2],hypercube_z[2]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[2],hypercube_y[2],hypercube_z[2]),glm::vec3(hypercube_x[3],hypercube_y[3],hypercube_z[3]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[3],hypercube_y[3],hypercube_z[3]),glm::vec3(hypercube_x[4],hypercube_y[4],hypercube_z[4]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[4],hypercube_y[4],hypercube_z[4]),glm::vec3(hypercube_x[5],hypercube_y[5],hypercube_z[5]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[5],hypercube_y[5],hypercube_z[5]),glm::vec3(hypercube_x[6],hypercube_y[6],hypercube_z[6]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[6],hypercube_y[6],hypercube_z[6]),glm::vec3(hypercube_x[7],hypercube_y[7],hypercube_z[7]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[7],hypercube_y[7],hypercube_z[7]),glm::vec3(hypercube_x[0],hypercube_y[0],hypercube_z[0]));
+
+        generatorBatch.addLine(glm::vec3(hypercube_x[0],hypercube_y[0],-hypercube_z[0]),glm::vec3(hypercube_x[1],hypercube_y[1],-hypercube_z[1]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[1],hypercube_y[1],-hypercube_z[1]),glm::vec3(hypercube_x[2],hypercube_y[2],-hypercube_z[2]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[2],hypercube_y[2],-hypercube_z[2]),glm::vec3(hypercube_x[3],hypercube_y[3],-hypercube_z[3]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[3],hypercube_y[3],-hypercube_z[3]),glm::vec3(hypercube_x[4],hypercube_y[4],-hypercube_z[4]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[4],hypercube_y[4],-hypercube_z[4]),glm::vec3(hypercube_x[5],hypercube_y[5],-hypercube_z[5]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[5],hypercube_y[5],-hypercube_z[5]),glm::vec3(hypercube_x[6],hypercube_y[6],-hypercube_z[6]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[6],hypercube_y[6],-hypercube_z[6]),glm::vec3(hypercube_x[7],hypercube_y[7],-hypercube_z[7]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[7],hypercube_y[7],-hypercube_z[7]),glm::vec3(hypercube_x[0],hypercube_y[0],-hypercube_z[0]));
+
+        generatorBatch.addLine(glm::vec3(hypercube_x[0],hypercube_y[0],hypercube_z[0]),glm::vec3(hypercube_x[0],hypercube_y[0],-hypercube_z[0]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[1],hypercube_y[1],hypercube_z[1]),glm::vec3(hypercube_x[1],hypercube_y[1],-hypercube_z[1]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[2],hypercube_y[2],hypercube_z[2]),glm::vec3(hypercube_x[2],hypercube_y[2],-hypercube_z[2]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[3],hypercube_y[3],hypercube_z[3]),glm::vec3(hypercube_x[3],hypercube_y[3],-hypercube_z[3]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[4],hypercube_y[4],hypercube_z[4]),glm::vec3(hypercube_x[4],hypercube_y[4],-hypercube_z[4]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[5],hypercube_y[5],hypercube_z[5]),glm::vec3(hypercube_x[5],hypercube_y[5],-hypercube_z[5]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[6],hypercube_y[6],hypercube_z[6]),glm::vec3(hypercube_x[6],hypercube_y[6],-hypercube_z[6]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[7],hypercube_y[7],hypercube_z[7]),glm::vec3(hypercube_x[7],hypercube_y[7],-hypercube_z[7]));
+
+        generatorBatch.addLine(glm::vec3(hypercube_x[0],hypercube_y[0],-hypercube_z[0]),glm::vec3(hypercube_x[4],hypercube_y[4],-hypercube_z[4]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[1],hypercube_y[1],-hypercube_z[1]),glm::vec3(hypercube_x[5],hypercube_y[5],-hypercube_z[5]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[2],hypercube_y[2],-hypercube_z[2]),glm::vec3(hypercube_x[6],hypercube_y[6],-hypercube_z[6]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[3],hypercube_y[3],-hypercube_z[3]),glm::vec3(hypercube_x[7],hypercube_y[7],-hypercube_z[7]));
+
+        generatorBatch.addLine(glm::vec3(hypercube_x[0],hypercube_y[0],hypercube_z[0]),glm::vec3(hypercube_x[4],hypercube_y[4],hypercube_z[4]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[1],hypercube_y[1],hypercube_z[1]),glm::vec3(hypercube_x[5],hypercube_y[5],hypercube_z[5]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[2],hypercube_y[2],hypercube_z[2]),glm::vec3(hypercube_x[6],hypercube_y[6],hypercube_z[6]));
+        generatorBatch.addLine(glm::vec3(hypercube_x[3],hypercube_y[3],hypercube_z[3]),glm::vec3(hypercube_x[7],hypercube_y[7],hypercube_z[7]));
 
         ofPopMatrix();
 
     }//endifor
-    ofFill();
 }
 
 //---------------------------------------------------------
@@ -2635,11 +2734,11 @@ void ofApp::sevenStar1Draw() {
 
 	ofColor hsbC1;
 	hsbC1.setHsb(127.0f + 63.0f * sin(thetaHue1 + thetaChaos) + 63.0f * cos(thetaHue2 - thetaChaos), 190.0f + 63.0f * cos(thetaSaturation1), 255);
-	ofSetColor(hsbC1);
-	ofDrawEllipse(shapedX, shapedY, squareSize, squareSize);
+	generatorBatch.setColor(hsbC1);
+	generatorBatch.addEllipse(shapedX, shapedY, squareSize, squareSize);
 	hsbC1.setHsb(255.0f - (127.0f + 63.0f * sin(thetaHue1 + thetaChaos) + 63.0f * cos(thetaHue2 - thetaChaos)), 190.0f + 63.0f * cos(thetaSaturation1), 200);
-	ofSetColor(hsbC1);
-	ofDrawEllipse(shapedX, shapedY, squareSize - 2, squareSize - 2);
+	generatorBatch.setColor(hsbC1);
+	generatorBatch.addEllipse(shapedX, shapedY, squareSize - 2, squareSize - 2);
 
 	if (position1 != points1[index1]) {
 		increment1 += acceleration1;
@@ -2654,11 +2753,11 @@ void ofApp::sevenStar1Draw() {
 	position2.y = ofLerp(position2.y, points2[index2].y, increment2);
 
 	hsbC1.setHsb(127.0f + 63.0f * sin(thetaHue2 + thetaChaos) - 63.0f * cos(thetaHue1 - thetaChaos), 190.0f + 63.0f * cos(thetaSaturation1 - thetaHue1), 255);
-	ofSetColor(hsbC1);
-	ofDrawEllipse(position2.x, position2.y, squareSize, squareSize);
+	generatorBatch.setColor(hsbC1);
+	generatorBatch.addEllipse(position2.x, position2.y, squareSize, squareSize);
 	hsbC1.setHsb(255.0f-(127.0f + 63.0f * sin(thetaHue2 + thetaChaos) - 63.0f * cos(thetaHue1 - thetaChaos)), 190.0f + 63.0f * cos(thetaSaturation1 - thetaHue1), 200);
-	ofSetColor(hsbC1);
-	ofDrawEllipse(position2.x, position2.y, squareSize - 2, squareSize - 2);
+	generatorBatch.setColor(hsbC1);
+	generatorBatch.addEllipse(position2.x, position2.y, squareSize - 2, squareSize - 2);
 
 	if (position2 != points2[index2]) {
 		increment2 += acceleration2;
@@ -2706,10 +2805,10 @@ void ofApp::drawSpiralEllipse() {
 	ofDrawEllipse(x3, y3, size, size);
 	*/
 
-	ofSetColor(190 + 63 * sin(spiralTheta3 - .00001*y2), 127 + 127 * cos(spiralTheta2 + .00001*x3), 190 + 63 * sin(spiralTheta1 - .00001*y1), 255);
-	ofDrawEllipse(x1, y1, size, size);
-	ofSetColor(255 - (63 + 190 * sin(spiralTheta3 - .00001*y2)), 255 - (127 + 127 * cos(spiralTheta2 + .00001*x3)), 255 - (63 + 190 * sin(spiralTheta1 - .00001*y1)), 255);
-	ofDrawEllipse(x1, y1, size - 2, size - 2);
+	generatorBatch.setColor(ofColor(190 + 63 * sin(spiralTheta3 - .00001*y2), 127 + 127 * cos(spiralTheta2 + .00001*x3), 190 + 63 * sin(spiralTheta1 - .00001*y1), 255));
+	generatorBatch.addEllipse(x1, y1, size, size);
+	generatorBatch.setColor(ofColor(255 - (63 + 190 * sin(spiralTheta3 - .00001*y2)), 255 - (127 + 127 * cos(spiralTheta2 + .00001*x3)), 255 - (63 + 190 * sin(spiralTheta1 - .00001*y1)), 255));
+	generatorBatch.addEllipse(x1, y1, size - 2, size - 2);
 
 	/*
 	ofSetColor(190 + 63 * sin(.1*spiralTheta1 - .00001*x3), 127 + 127 * cos(.1*spiralTheta3 + .00001*x2), 190 + 63 * cos(.1*spiralTheta2 - .00001*y1), 255);
@@ -2748,27 +2847,16 @@ void ofApp::drawSpiralEllipse() {
 }
 
 //--------------------------------------------------------------
-// Lissajous Curve Generator - Waveshape function
-float ofApp::lissajousWave(float theta, int shape) {
-	switch(shape) {
-		case 0: return sin(theta);                                         // Sine
-		case 1: return (2.0f / PI) * asin(sin(theta));                    // Triangle
-		case 2: return (2.0f / TWO_PI) * fmod(theta + PI, TWO_PI) - 1.0f; // Ramp
-		case 3: return 1.0f - (2.0f / TWO_PI) * fmod(theta + PI, TWO_PI); // Saw
-		case 4: return (sin(theta) >= 0.0f) ? 1.0f : -1.0f;               // Square
-		default: return sin(theta);
+// Lissajous Curve Generator - shader, parameter blocks and the empty vertex array it draws from
+void ofApp::lissajousSetup(const std::string& shaderDir) {
+	glGenVertexArrays(1, &generatorVao);
+	for (auto& buffer : lissajousUniformBuffer) {
+		buffer.allocate(sizeof(LissajousUniforms), GL_DYNAMIC_DRAW);
 	}
-}
-
-//--------------------------------------------------------------
-// Lissajous Curve Generator - Chop envelope function
-float ofApp::chopEnvelope(float pos, int shape) {
-	switch(shape) {
-		case 0: return sin(pos * PI);                      // Sine: smooth hump
-		case 1: return 1.0f - 2.0f * fabs(pos - 0.5f);    // Triangle: peak at center
-		case 2: return pos;                                // Ramp: 0->1
-		case 3: return 1.0f - pos;                         // Saw: 1->0
-		case 4: default: return 1.0f;                      // Square: uniform
+	if (lissajousShader.load(shaderDir + "/lissajous")) {
+		lissajousShader.bindUniformBlock(LISSAJOUS_UNIFORM_BINDING, "LissajousParams");
+	} else {
+		ofLogError("Shader") << "Lissajous curve shader failed to load, curves are disabled";
 	}
 }
 
@@ -2842,46 +2930,17 @@ void ofApp::lissajousCurve1Draw() {
 	if (lissajous1Theta > TWO_PI * 1000) lissajous1Theta = fmod(lissajous1Theta, TWO_PI * 100);
 	if (lissajous1ColorTheta > TWO_PI * 1000) lissajous1ColorTheta = fmod(lissajous1ColorTheta, TWO_PI * 100);
 
-	ofPushMatrix();
-	ofTranslate(outputWidth / 2 + xCenter, outputHeight / 2 + yCenter);
-	ofSetLineWidth(lineWidth);
-
-	// Use ofMesh for proper per-vertex colors with chop support
-	std::vector<ofMesh> meshes(chopCount);
-	for (auto& m : meshes) m.setMode(OF_PRIMITIVE_LINE_STRIP);
-
-	for (int i = 0; i < numPoints; i++) {
-		float normalizedPos = float(i) / numPoints;
-		int segIdx = std::min(int(normalizedPos * chopCount), chopCount - 1);
-		float posInSegment = fmod(normalizedPos * chopCount, 1.0f);
-
-		bool visible = (chopCount == 1) || (posInSegment < visibleRatio);
-		if (!visible) continue;
-
-		float visiblePos = (chopCount == 1) ? normalizedPos : (posInSegment / visibleRatio);
-		float brightness = 220.0f * chopEnvelope(visiblePos, gui->lissajous1ChopShape);
-
-		float t = lissajous1Theta + (float(i) / numPoints) * TWO_PI * 4;
-
-		float x = xAmp * sizeScale * lissajousWave(xFreq * t + xPhase, gui->lissajous1XShape);
-		float y = yAmp * sizeScale * lissajousWave(yFreq * t + yPhase, gui->lissajous1YShape);
-		float z = zAmp * sizeScale * lissajousWave(zFreq * t + zPhase, gui->lissajous1ZShape);
-
-		float positionHue = (float(i) / numPoints) * hueSpreadMod;
-		float hue = fmod(hueMod + positionHue + lissajous1ColorTheta, 1.0f);
-		ofColor c;
-		c.setHsb(hue * 255, 200, brightness);
-
-		meshes[segIdx].addVertex(glm::vec3(x, y, z));
-		meshes[segIdx].addColor(c);
-	}
-
-	for (auto& m : meshes) {
-		if (m.getNumVertices() > 1) m.draw();
-	}
-
-	ofSetLineWidth(1);
-	ofPopMatrix();
+	// Every point is evaluated in shadersGL4/lissajous.vert
+	LissajousUniforms params;
+	params.freq = glm::vec4(xFreq, yFreq, zFreq, 0);
+	params.amp = glm::vec4(xAmp, yAmp, zAmp, 0) * sizeScale;
+	params.phase = glm::vec4(xPhase, yPhase, zPhase, 0);
+	params.shape = glm::ivec4(gui->lissajous1XShape, gui->lissajous1YShape, gui->lissajous1ZShape, gui->lissajous1ChopShape);
+	params.center = glm::vec4(outputWidth / 2 + xCenter, outputHeight / 2 + yCenter, 0, 0);
+	params.hue = glm::vec4(lissajous1Theta, lissajous1ColorTheta, hueMod, hueSpreadMod);
+	params.chop = glm::vec4(numPoints, chopCount, visibleRatio, 0);
+	params.instances = glm::vec4(ofClamp(gui->lissajous1Count, 1, GuiApp::LISSAJOUS_MAX_COUNT), ofClamp(gui->lissajous1Spread, 0.0f, 1.0f), 0, 0);
+	lissajousCurveRender(0, params, lineWidth);
 }
 
 //--------------------------------------------------------------
@@ -2954,46 +3013,50 @@ void ofApp::lissajousCurve2Draw() {
 	if (lissajous2Theta > TWO_PI * 1000) lissajous2Theta = fmod(lissajous2Theta, TWO_PI * 100);
 	if (lissajous2ColorTheta > TWO_PI * 1000) lissajous2ColorTheta = fmod(lissajous2ColorTheta, TWO_PI * 100);
 
-	ofPushMatrix();
-	ofTranslate(outputWidth / 2 + xCenter, outputHeight / 2 + yCenter);
-	ofSetLineWidth(lineWidth);
-
-	// Use ofMesh for proper per-vertex colors with chop support
-	std::vector<ofMesh> meshes(chopCount);
-	for (auto& m : meshes) m.setMode(OF_PRIMITIVE_LINE_STRIP);
-
-	for (int i = 0; i < numPoints; i++) {
-		float normalizedPos = float(i) / numPoints;
-		int segIdx = std::min(int(normalizedPos * chopCount), chopCount - 1);
-		float posInSegment = fmod(normalizedPos * chopCount, 1.0f);
-
-		bool visible = (chopCount == 1) || (posInSegment < visibleRatio);
-		if (!visible) continue;
-
-		float visiblePos = (chopCount == 1) ? normalizedPos : (posInSegment / visibleRatio);
-		float brightness = 220.0f * chopEnvelope(visiblePos, gui->lissajous2ChopShape);
-
-		float t = lissajous2Theta + (float(i) / numPoints) * TWO_PI * 4;
-
-		float x = xAmp * sizeScale * lissajousWave(xFreq * t + xPhase, gui->lissajous2XShape);
-		float y = yAmp * sizeScale * lissajousWave(yFreq * t + yPhase, gui->lissajous2YShape);
-		float z = zAmp * sizeScale * lissajousWave(zFreq * t + zPhase, gui->lissajous2ZShape);
-
-		float positionHue = (float(i) / numPoints) * hueSpreadMod;
-		float hue = fmod(hueMod + positionHue + lissajous2ColorTheta, 1.0f);
-		ofColor c;
-		c.setHsb(hue * 255, 200, brightness);
+	// Every point is evaluated in shadersGL4/lissajous.vert
+	LissajousUniforms params;
+	params.freq = glm::vec4(xFreq, yFreq, zFreq, 0);
+	params.amp = glm::vec4(xAmp, yAmp, zAmp, 0) * sizeScale;
+	params.phase = glm::vec4(xPhase, yPhase, zPhase, 0);
+	params.shape = glm::ivec4(gui->lissajous2XShape, gui->lissajous2YShape, gui->lissajous2ZShape, gui->lissajous2ChopShape);
+	params.center = glm::vec4(outputWidth / 2 + xCenter, outputHeight / 2 + yCenter, 0, 0);
+	params.hue = glm::vec4(lissajous2Theta, lissajous2ColorTheta, hueMod, hueSpreadMod);
+	params.chop = glm::vec4(numPoints, chopCount, visibleRatio, 0);
+	params.instances = glm::vec4(ofClamp(gui->lissajous2Count, 1, GuiApp::LISSAJOUS_MAX_COUNT), ofClamp(gui->lissajous2Spread, 0.0f, 1.0f), 0, 0);
+	lissajousCurveRender(1, params, lineWidth);
+}
 
-		meshes[segIdx].addVertex(glm::vec3(x, y, z));
-		meshes[segIdx].addColor(c);
-	}
+//--------------------------------------------------------------
+// Lissajous Curve Generator - one draw of 2 * (points - 1) vertices without vertex data,
+// instanced once per copy of the curve
+void ofApp::lissajousCurveRender(int block, const LissajousUniforms& params, float lineWidth) {
+	if (!lissajousShader.isLoaded()) return;
 
-	for (auto& m : meshes) {
-		if (m.getNumVertices() > 1) m.draw();
-	}
+	lissajousUniformBuffer[block].updateData(0, sizeof(LissajousUniforms), &params);
+	lissajousUniformBuffer[block].bindBase(GL_UNIFORM_BUFFER, LISSAJOUS_UNIFORM_BINDING);
 
+	ofSetLineWidth(lineWidth);
+	lissajousShader.begin();
+	glBindVertexArray(generatorVao);
+	glDrawArraysInstanced(GL_LINES, 0, 2 * ((int)params.chop.x - 1), (int)params.instances.x);
+	glBindVertexArray(0);
+	lissajousShader.end();
 	ofSetLineWidth(1);
-	ofPopMatrix();
+}
+
+//--------------------------------------------------------------
+// Particle Generator - GUI values mapped to particle counts and pixels
+void ofApp::particlesDraw(int block, const ofTexture& field, glm::vec2 fieldScale) {
+	float amount = block == 0 ? gui->particles1Amount : gui->particles2Amount;
+	ParticleGenerator::Settings settings;
+	settings.count = 1024 + int(ofClamp(amount, 0.0f, 1.0f) * (ParticleGenerator::MAX_PARTICLES - 1024));
+	settings.speed = block == 0 ? gui->particles1Speed : gui->particles2Speed;
+	settings.flow = block == 0 ? gui->particles1Flow : gui->particles2Flow;
+	settings.pointSize = 1.0f + 7.0f * (block == 0 ? gui->particles1Size : gui->particles2Size);
+	settings.hue = block == 0 ? gui->particles1Hue : gui->particles2Hue;
+
+	particleGenerator.update(block, field, fieldScale, settings);
+	particleGenerator.draw(block, settings);
 }
 
 //--------------------------------------------------------------
@@ -3018,407 +3081,123 @@ void ofApp::processOscMessages() {
     while(oscReceiver.hasWaitingMessages()) {
         ofxOscMessage m;
         oscReceiver.getNextMessage(m);
+        applyOscMessage(m);
+    }
 
-        string address = m.getAddress();
-        float value = m.getArgAsFloat(0);
-
-        ofLogNotice("OSC") << "Received: " << address << " = " << value;
-
-        // Try registry lookup first (handles all registered parameters)
-        auto it = gui->oscAddressMap.find(address);
-        if (it != gui->oscAddressMap.end() && it->second != nullptr) {
-            it->second->setValueFromFloat(value);
-            continue;  // Found in registry, skip the helper functions
-        }
+    // Timetagged bundle contents wait in the scheduler for their frame
+    double now = OscBundleReceiver::nowSeconds();
+    OscBundleReceiver::TimedMessage timed;
+    while (oscReceiver.getNextTimedMessage(timed)) {
+        scheduleOscMessage(timed, now);
+    }
 
-        // Fallback to helper functions for any unregistered parameters
-        if (processOscBlock1(address, value, m)) continue;
-        if (processOscBlock2(address, value, m)) continue;
-        if (processOscBlock3(address, value, m)) continue;
-        if (processOscDiscreteParams(address, m)) continue;
-        if (processOscBooleanParams(address, m)) continue;
-        if (processOscLfoParamsFb(address, value)) continue;
-        if (processOscLfoParamsBlock3B1(address, value)) continue;
-        if (processOscLfoParamsBlock3B2AndMatrix(address, value)) continue;
-        if (processOscResetCommands(address)) continue;
-        if (processOscPresetCommands(address, m)) continue;
+    // A frame rendered now reaches the screen roughly one frame period later
+    double framePeriod = 1.0 / (double)max(gui->targetFPS, 1);
+    double presentationTime = now + framePeriod;
+    while (!oscSchedule.empty() && oscSchedule.begin()->first <= presentationTime) {
+        applyOscMessage(oscSchedule.begin()->second);
+        oscSchedule.erase(oscSchedule.begin());
     }
 }
 
 //--------------------------------------------------------------
-// OSC PROCESS HELPER FUNCTIONS - Split to avoid MSVC compiler limits
-//--------------------------------------------------------------
-bool ofApp::processOscBlock1(const string& address, float value, const ofxOscMessage& m) {
-    // BLOCK 1 - Channel 1 Adjust (15 parameters)
-    if (address == "/gravity/block1/ch1/xDisplace") gui->ch1Adjust[0] = value;
-    else if (address == "/gravity/block1/ch1/yDisplace") gui->ch1Adjust[1] = value;
-    else if (address == "/gravity/block1/ch1/zDisplace") gui->ch1Adjust[2] = value;
-    else if (address == "/gravity/block1/ch1/rotate") gui->ch1Adjust[3] = value;
-    else if (address == "/gravity/block1/ch1/hueOffset") gui->ch1Adjust[4] = value;
-    else if (address == "/gravity/block1/ch1/saturationOffset") gui->ch1Adjust[5] = value;
-    else if (address == "/gravity/block1/ch1/brightOffset") gui->ch1Adjust[6] = value;
-    else if (address == "/gravity/block1/ch1/posterize") gui->ch1Adjust[7] = value;
-    else if (address == "/gravity/block1/ch1/kaleidoscopeAmount") gui->ch1Adjust[8] = value;
-    else if (address == "/gravity/block1/ch1/kaleidoscopeSlice") gui->ch1Adjust[9] = value;
-    else if (address == "/gravity/block1/ch1/blurAmount") gui->ch1Adjust[10] = value;
-    else if (address == "/gravity/block1/ch1/blurRadius") gui->ch1Adjust[11] = value;
-    else if (address == "/gravity/block1/ch1/sharpenAmount") gui->ch1Adjust[12] = value;
-    else if (address == "/gravity/block1/ch1/sharpenRadius") gui->ch1Adjust[13] = value;
-    else if (address == "/gravity/block1/ch1/filtersBoost") gui->ch1Adjust[14] = value;
-
-    // BLOCK 1 - Channel 1 Adjust LFO (16 parameters)
-    else if (address == "/gravity/block1/ch1/lfo/xDisplaceAmp") gui->ch1AdjustLfo[0] = value;
-    else if (address == "/gravity/block1/ch1/lfo/xDisplaceRate") gui->ch1AdjustLfo[1] = value;
-    else if (address == "/gravity/block1/ch1/lfo/yDisplaceAmp") gui->ch1AdjustLfo[2] = value;
-    else if (address == "/gravity/block1/ch1/lfo/yDisplaceRate") gui->ch1AdjustLfo[3] = value;
-    else if (address == "/gravity/block1/ch1/lfo/zDisplaceAmp") gui->ch1AdjustLfo[4] = value;
-    else if (address == "/gravity/block1/ch1/lfo/zDisplaceRate") gui->ch1AdjustLfo[5] = value;
-    else if (address == "/gravity/block1/ch1/lfo/rotateAmp") gui->ch1AdjustLfo[6] = value;
-    else if (address == "/gravity/block1/ch1/lfo/rotateRate") gui->ch1AdjustLfo[7] = value;
-    else if (address == "/gravity/block1/ch1/lfo/kaleidoscopeSliceAmp") gui->ch1AdjustLfo[14] = value;
-    else if (address == "/gravity/block1/ch1/lfo/kaleidoscopeSliceRate") gui->ch1AdjustLfo[15] = value;
-    else if (address == "/gravity/block1/ch1/lfo/hueOffsetAmp") gui->ch1AdjustLfo[8] = value;
-    else if (address == "/gravity/block1/ch1/lfo/hueOffsetRate") gui->ch1AdjustLfo[9] = value;
-    else if (address == "/gravity/block1/ch1/lfo/saturationOffsetAmp") gui->ch1AdjustLfo[10] = value;
-    else if (address == "/gravity/block1/ch1/lfo/saturationOffsetRate") gui->ch1AdjustLfo[11] = value;
-    else if (address == "/gravity/block1/ch1/lfo/brightOffsetAmp") gui->ch1AdjustLfo[12] = value;
-    else if (address == "/gravity/block1/ch1/lfo/brightOffsetRate") gui->ch1AdjustLfo[13] = value;
-
-    // BLOCK 1 - Channel 2 Mix and Key (7 parameters)
-    else if (address == "/gravity/block1/ch2/mixAmount") gui->ch2MixAndKey[0] = value;
-    else if (address == "/gravity/block1/ch2/keyThreshold") gui->ch2MixAndKey[4] = value;
-    else if (address == "/gravity/block1/ch2/keySoft") gui->ch2MixAndKey[5] = value;
-    else if (address == "/gravity/block1/ch2/keyBlue") gui->ch2MixAndKey[3] = value;
-    else if (address == "/gravity/block1/ch2/keyRed") gui->ch2MixAndKey[1] = value;
-    else if (address == "/gravity/block1/ch2/keyGreen") gui->ch2MixAndKey[2] = value;
-
-    // BLOCK 1 - Channel 2 Mix and Key LFO (6 parameters)
-    else if (address == "/gravity/block1/ch2/lfo/mixAmountAmp") gui->ch2MixAndKeyLfo[0] = value;
-    else if (address == "/gravity/block1/ch2/lfo/mixAmountRate") gui->ch2MixAndKeyLfo[1] = value;
-    else if (address == "/gravity/block1/ch2/lfo/keyThresholdAmp") gui->ch2MixAndKeyLfo[2] = value;
-    else if (address == "/gravity/block1/ch2/lfo/keyThresholdRate") gui->ch2MixAndKeyLfo[3] = value;
-    else if (address == "/gravity/block1/ch2/lfo/keySoftAmp") gui->ch2MixAndKeyLfo[4] = value;
-    else if (address == "/gravity/block1/ch2/lfo/keySoftRate") gui->ch2MixAndKeyLfo[5] = value;
-
-    // BLOCK 1 - Channel 2 Adjust (15 parameters)
-    else if (address == "/gravity/block1/ch2/xDisplace") gui->ch2Adjust[0] = value;
-    else if (address == "/gravity/block1/ch2/yDisplace") gui->ch2Adjust[1] = value;
-    else if (address == "/gravity/block1/ch2/zDisplace") gui->ch2Adjust[2] = value;
-    else if (address == "/gravity/block1/ch2/rotate") gui->ch2Adjust[3] = value;
-    else if (address == "/gravity/block1/ch2/hueOffset") gui->ch2Adjust[4] = value;
-    else if (address == "/gravity/block1/ch2/saturationOffset") gui->ch2Adjust[5] = value;
-    else if (address == "/gravity/block1/ch2/brightOffset") gui->ch2Adjust[6] = value;
-    else if (address == "/gravity/block1/ch2/posterize") gui->ch2Adjust[7] = value;
-    else if (address == "/gravity/block1/ch2/kaleidoscopeAmount") gui->ch2Adjust[8] = value;
-    else if (address == "/gravity/block1/ch2/kaleidoscopeSlice") gui->ch2Adjust[9] = value;
-    else if (address == "/gravity/block1/ch2/blurAmount") gui->ch2Adjust[10] = value;
-    else if (address == "/gravity/block1/ch2/blurRadius") gui->ch2Adjust[11] = value;
-    else if (address == "/gravity/block1/ch2/sharpenAmount") gui->ch2Adjust[12] = value;
-    else if (address == "/gravity/block1/ch2/sharpenRadius") gui->ch2Adjust[13] = value;
-    else if (address == "/gravity/block1/ch2/filtersBoost") gui->ch2Adjust[14] = value;
-
-    // BLOCK 1 - Channel 2 Adjust LFO (16 parameters)
-    else if (address == "/gravity/block1/ch2/lfo/xDisplaceAmp") gui->ch2AdjustLfo[0] = value;
-    else if (address == "/gravity/block1/ch2/lfo/xDisplaceRate") gui->ch2AdjustLfo[1] = value;
-    else if (address == "/gravity/block1/ch2/lfo/yDisplaceAmp") gui->ch2AdjustLfo[2] = value;
-    else if (address == "/gravity/block1/ch2/lfo/yDisplaceRate") gui->ch2AdjustLfo[3] = value;
-    else if (address == "/gravity/block1/ch2/lfo/zDisplaceAmp") gui->ch2AdjustLfo[4] = value;
-    else if (address == "/gravity/block1/ch2/lfo/zDisplaceRate") gui->ch2AdjustLfo[5] = value;
-    else if (address == "/gravity/block1/ch2/lfo/rotateAmp") gui->ch2AdjustLfo[6] = value;
-    else if (address == "/gravity/block1/ch2/lfo/rotateRate") gui->ch2AdjustLfo[7] = value;
-    else if (address == "/gravity/block1/ch2/lfo/kaleidoscopeSliceAmp") gui->ch2AdjustLfo[14] = value;
-    else if (address == "/gravity/block1/ch2/lfo/kaleidoscopeSliceRate") gui->ch2AdjustLfo[15] = value;
-    else if (address == "/gravity/block1/ch2/lfo/hueOffsetAmp") gui->ch2AdjustLfo[8] = value;
-    else if (address == "/gravity/block1/ch2/lfo/hueOffsetRate") gui->ch2AdjustLfo[9] = value;
-    else if (address == "/gravity/block1/ch2/lfo/saturationOffsetAmp") gui->ch2AdjustLfo[10] = value;
-    else if (address == "/gravity/block1/ch2/lfo/saturationOffsetRate") gui->ch2AdjustLfo[11] = value;
-    else if (address == "/gravity/block1/ch2/lfo/brightOffsetAmp") gui->ch2AdjustLfo[12] = value;
-    else if (address == "/gravity/block1/ch2/lfo/brightOffsetRate") gui->ch2AdjustLfo[13] = value;
-
-    // BLOCK 1 - FB1 Mix and Key (6 parameters)
-    else if (address == "/gravity/block1/fb1/mixAmount") gui->fb1MixAndKey[0] = value;
-    else if (address == "/gravity/block1/fb1/keyThreshold") gui->fb1MixAndKey[4] = value;
-    else if (address == "/gravity/block1/fb1/keySoft") gui->fb1MixAndKey[5] = value;
-    else if (address == "/gravity/block1/fb1/keyBlue") gui->fb1MixAndKey[3] = value;
-    else if (address == "/gravity/block1/fb1/keyRed") gui->fb1MixAndKey[1] = value;
-    else if (address == "/gravity/block1/fb1/keyGreen") gui->fb1MixAndKey[2] = value;
-
-    // BLOCK 1 - FB1 Geometry (10 parameters)
-    else if (address == "/gravity/block1/fb1/xDisplace") gui->fb1Geo1[0] = value;
-    else if (address == "/gravity/block1/fb1/yDisplace") gui->fb1Geo1[1] = value;
-    else if (address == "/gravity/block1/fb1/zDisplace") gui->fb1Geo1[2] = value;
-    else if (address == "/gravity/block1/fb1/rotate") gui->fb1Geo1[3] = value;
-    else if (address == "/gravity/block1/fb1/xStretch") gui->fb1Geo1[4] = value;
-    else if (address == "/gravity/block1/fb1/yStretch") gui->fb1Geo1[5] = value;
-    else if (address == "/gravity/block1/fb1/xShear") gui->fb1Geo1[6] = value;
-    else if (address == "/gravity/block1/fb1/yShear") gui->fb1Geo1[7] = value;
-    else if (address == "/gravity/block1/fb1/kaleidoscopeAmount") gui->fb1Geo1[8] = value;
-    else if (address == "/gravity/block1/fb1/kaleidoscopeSlice") gui->fb1Geo1[9] = value;
-
-    // BLOCK 1 - FB1 Color (11 parameters)
-    else if (address == "/gravity/block1/fb1/hueOffset") gui->fb1Color1[0] = value;
-    else if (address == "/gravity/block1/fb1/saturationOffset") gui->fb1Color1[1] = value;
-    else if (address == "/gravity/block1/fb1/brightOffset") gui->fb1Color1[2] = value;
-    else if (address == "/gravity/block1/fb1/hueMultiply") gui->fb1Color1[3] = value;
-    else if (address == "/gravity/block1/fb1/saturationMultiply") gui->fb1Color1[4] = value;
-    else if (address == "/gravity/block1/fb1/brightMultiply") gui->fb1Color1[5] = value;
-    else if (address == "/gravity/block1/fb1/huePowmap") gui->fb1Color1[6] = value;
-    else if (address == "/gravity/block1/fb1/saturationPowmap") gui->fb1Color1[7] = value;
-    else if (address == "/gravity/block1/fb1/brightPowmap") gui->fb1Color1[8] = value;
-    else if (address == "/gravity/block1/fb1/hueShaper") gui->fb1Color1[9] = value;
-    else if (address == "/gravity/block1/fb1/posterize") gui->fb1Color1[10] = value;
-
-    // BLOCK 1 - FB1 Filters (9 parameters)
-    else if (address == "/gravity/block1/fb1/blurAmount") gui->fb1Filters[0] = value;
-    else if (address == "/gravity/block1/fb1/blurRadius") gui->fb1Filters[1] = value;
-    else if (address == "/gravity/block1/fb1/sharpenAmount") gui->fb1Filters[2] = value;
-    else if (address == "/gravity/block1/fb1/sharpenRadius") gui->fb1Filters[3] = value;
-    else if (address == "/gravity/block1/fb1/temp1Amount") gui->fb1Filters[4] = value;
-    else if (address == "/gravity/block1/fb1/temp1q") gui->fb1Filters[5] = value;
-    else if (address == "/gravity/block1/fb1/temp2Amount") gui->fb1Filters[6] = value;
-    else if (address == "/gravity/block1/fb1/temp2q") gui->fb1Filters[7] = value;
-    else if (address == "/gravity/block1/fb1/filtersBoost") gui->fb1Filters[8] = value;
+void ofApp::scheduleOscMessage(OscBundleReceiver::TimedMessage& timed, double now) {
+    double dueTime = OscBundleReceiver::timeTagToSeconds(timed.timeTag) + gui->oscBundleLatencyMs * 0.001;
+    double framePeriod = 1.0 / (double)max(gui->targetFPS, 1);
+
+    if (dueTime < now) {
+        // Missed its frame already, apply as soon as possible
+        oscBundleStats.late++;
+        oscBundleStats.worstLateMs = max(oscBundleStats.worstLateMs, (float)((now - dueTime) * 1000.0));
+        applyOscMessage(timed.message);
+        return;
+    }
 
-    else return false;
-    return true;
+    if (dueTime - now > oscScheduleHorizon) {
+        // Sender clock is far ahead of ours; holding these would stall them forever
+        oscBundleStats.outOfRange++;
+        ofLogWarning("OSC") << "Bundle timetag " << (dueTime - now) << "s ahead, applying immediately";
+        applyOscMessage(timed.message);
+        return;
+    }
+
+    if (dueTime > now + framePeriod) oscBundleStats.early++;
+    oscBundleStats.scheduled++;
+    oscSchedule.emplace(dueTime, std::move(timed.message));
 }
 
 //--------------------------------------------------------------
-bool ofApp::processOscBlock2(const string& address, float value, const ofxOscMessage& m) {
-    // BLOCK 2 - Input Adjust (15 parameters)
-    if (address == "/gravity/block2/input/xDisplace") gui->block2InputAdjust[0] = value;
-    else if (address == "/gravity/block2/input/yDisplace") gui->block2InputAdjust[1] = value;
-    else if (address == "/gravity/block2/input/zDisplace") gui->block2InputAdjust[2] = value;
-    else if (address == "/gravity/block2/input/rotate") gui->block2InputAdjust[3] = value;
-    else if (address == "/gravity/block2/input/hueOffset") gui->block2InputAdjust[4] = value;
-    else if (address == "/gravity/block2/input/saturationOffset") gui->block2InputAdjust[5] = value;
-    else if (address == "/gravity/block2/input/brightOffset") gui->block2InputAdjust[6] = value;
-    else if (address == "/gravity/block2/input/posterize") gui->block2InputAdjust[7] = value;
-    else if (address == "/gravity/block2/input/kaleidoscopeAmount") gui->block2InputAdjust[8] = value;
-    else if (address == "/gravity/block2/input/kaleidoscopeSlice") gui->block2InputAdjust[9] = value;
-    else if (address == "/gravity/block2/input/blurAmount") gui->block2InputAdjust[10] = value;
-    else if (address == "/gravity/block2/input/blurRadius") gui->block2InputAdjust[11] = value;
-    else if (address == "/gravity/block2/input/sharpenAmount") gui->block2InputAdjust[12] = value;
-    else if (address == "/gravity/block2/input/sharpenRadius") gui->block2InputAdjust[13] = value;
-    else if (address == "/gravity/block2/input/filtersBoost") gui->block2InputAdjust[14] = value;
-
-    // BLOCK 2 - FB2 Mix and Key (6 parameters)
-    else if (address == "/gravity/block2/fb2/mixAmount") gui->fb2MixAndKey[0] = value;
-    else if (address == "/gravity/block2/fb2/keyThreshold") gui->fb2MixAndKey[4] = value;
-    else if (address == "/gravity/block2/fb2/keySoft") gui->fb2MixAndKey[5] = value;
-    else if (address == "/gravity/block2/fb2/keyBlue") gui->fb2MixAndKey[3] = value;
-    else if (address == "/gravity/block2/fb2/keyRed") gui->fb2MixAndKey[1] = value;
-    else if (address == "/gravity/block2/fb2/keyGreen") gui->fb2MixAndKey[2] = value;
-
-    // BLOCK 2 - FB2 Geometry (10 parameters)
-    else if (address == "/gravity/block2/fb2/xDisplace") gui->fb2Geo1[0] = value;
-    else if (address == "/gravity/block2/fb2/yDisplace") gui->fb2Geo1[1] = value;
-    else if (address == "/gravity/block2/fb2/zDisplace") gui->fb2Geo1[2] = value;
-    else if (address == "/gravity/block2/fb2/rotate") gui->fb2Geo1[3] = value;
-    else if (address == "/gravity/block2/fb2/xStretch") gui->fb2Geo1[4] = value;
-    else if (address == "/gravity/block2/fb2/yStretch") gui->fb2Geo1[5] = value;
-    else if (address == "/gravity/block2/fb2/xShear") gui->fb2Geo1[6] = value;
-    else if (address == "/gravity/block2/fb2/yShear") gui->fb2Geo1[7] = value;
-    else if (address == "/gravity/block2/fb2/kaleidoscopeAmount") gui->fb2Geo1[8] = value;
-    else if (address == "/gravity/block2/fb2/kaleidoscopeSlice") gui->fb2Geo1[9] = value;
-
-    // BLOCK 2 - FB2 Color (11 parameters)
-    else if (address == "/gravity/block2/fb2/hueOffset") gui->fb2Color1[0] = value;
-    else if (address == "/gravity/block2/fb2/saturationOffset") gui->fb2Color1[1] = value;
-    else if (address == "/gravity/block2/fb2/brightOffset") gui->fb2Color1[2] = value;
-    else if (address == "/gravity/block2/fb2/hueMultiply") gui->fb2Color1[3] = value;
-    else if (address == "/gravity/block2/fb2/saturationMultiply") gui->fb2Color1[4] = value;
-    else if (address == "/gravity/block2/fb2/brightMultiply") gui->fb2Color1[5] = value;
-    else if (address == "/gravity/block2/fb2/huePowmap") gui->fb2Color1[6] = value;
-    else if (address == "/gravity/block2/fb2/saturationPowmap") gui->fb2Color1[7] = value;
-    else if (address == "/gravity/block2/fb2/brightPowmap") gui->fb2Color1[8] = value;
-    else if (address == "/gravity/block2/fb2/hueShaper") gui->fb2Color1[9] = value;
-    else if (address == "/gravity/block2/fb2/posterize") gui->fb2Color1[10] = value;
-
-    // BLOCK 2 - FB2 Filters (9 parameters)
-    else if (address == "/gravity/block2/fb2/blurAmount") gui->fb2Filters[0] = value;
-    else if (address == "/gravity/block2/fb2/blurRadius") gui->fb2Filters[1] = value;
-    else if (address == "/gravity/block2/fb2/sharpenAmount") gui->fb2Filters[2] = value;
-    else if (address == "/gravity/block2/fb2/sharpenRadius") gui->fb2Filters[3] = value;
-    else if (address == "/gravity/block2/fb2/temp1Amount") gui->fb2Filters[4] = value;
-    else if (address == "/gravity/block2/fb2/temp1q") gui->fb2Filters[5] = value;
-    else if (address == "/gravity/block2/fb2/temp2Amount") gui->fb2Filters[6] = value;
-    else if (address == "/gravity/block2/fb2/temp2q") gui->fb2Filters[7] = value;
-    else if (address == "/gravity/block2/fb2/filtersBoost") gui->fb2Filters[8] = value;
+void ofApp::applyOscMessage(ofxOscMessage& m) {
+    string address = m.getAddress();
+    float value = m.getArgAsFloat(0);
+
+    ofLogNotice("OSC") << "Received: " << address << " = " << value;
+
+    // Try registry lookup first (handles all registered parameters)
+    auto it = gui->oscAddressMap.find(address);
+    if (it != gui->oscAddressMap.end() && it->second != nullptr) {
+        it->second->setValueFromFloat(value);
+        sendOscParameterEcho(address);
+        return;  // Found in registry, skip the helper functions
+    }
 
-    else return false;
-    return true;
+    // Address patterns fan out to every matching registered parameter
+    if (OscAddressPattern::isPattern(address)) {
+        const std::vector<OscParameter*>& handles = resolveOscPattern(address);
+        for (OscParameter* param : handles) {
+            param->setValueFromFloat(value);
+            sendOscParameterEcho(param->address);
+        }
+        return;
+    }
+
+    // Everything else is a command rather than a parameter
+    if (processOscSettingsCommands(address, m)) return;
+    if (processOscResetCommands(address)) return;
+    if (processOscPresetCommands(address, m)) return;
 }
 
 //--------------------------------------------------------------
-bool ofApp::processOscBlock3(const string& address, float value, const ofxOscMessage& m) {
-    // BLOCK 3 - Block 1 Geometry (10 parameters)
-    if (address == "/gravity/block3/b1/xDisplace") gui->block1Geo[0] = value;
-    else if (address == "/gravity/block3/b1/yDisplace") gui->block1Geo[1] = value;
-    else if (address == "/gravity/block3/b1/zDisplace") gui->block1Geo[2] = value;
-    else if (address == "/gravity/block3/b1/rotate") gui->block1Geo[3] = value;
-    else if (address == "/gravity/block3/b1/xStretch") gui->block1Geo[4] = value;
-    else if (address == "/gravity/block3/b1/yStretch") gui->block1Geo[5] = value;
-    else if (address == "/gravity/block3/b1/xShear") gui->block1Geo[6] = value;
-    else if (address == "/gravity/block3/b1/yShear") gui->block1Geo[7] = value;
-    else if (address == "/gravity/block3/b1/kaleidoscopeAmount") gui->block1Geo[8] = value;
-    else if (address == "/gravity/block3/b1/kaleidoscopeSlice") gui->block1Geo[9] = value;
-
-    // BLOCK 3 - Block 1 Colorize (15 parameters)
-    else if (address == "/gravity/block3/b1/colorize/hueBand1") gui->block1Colorize[0] = value;
-    else if (address == "/gravity/block3/b1/colorize/saturationBand1") gui->block1Colorize[1] = value;
-    else if (address == "/gravity/block3/b1/colorize/brightBand1") gui->block1Colorize[2] = value;
-    else if (address == "/gravity/block3/b1/colorize/hueBand2") gui->block1Colorize[3] = value;
-    else if (address == "/gravity/block3/b1/colorize/saturationBand2") gui->block1Colorize[4] = value;
-    else if (address == "/gravity/block3/b1/colorize/brightBand2") gui->block1Colorize[5] = value;
-    else if (address == "/gravity/block3/b1/colorize/hueBand3") gui->block1Colorize[6] = value;
-    else if (address == "/gravity/block3/b1/colorize/saturationBand3") gui->block1Colorize[7] = value;
-    else if (address == "/gravity/block3/b1/colorize/brightBand3") gui->block1Colorize[8] = value;
-    else if (address == "/gravity/block3/b1/colorize/hueBand4") gui->block1Colorize[9] = value;
-    else if (address == "/gravity/block3/b1/colorize/saturationBand4") gui->block1Colorize[10] = value;
-    else if (address == "/gravity/block3/b1/colorize/brightBand4") gui->block1Colorize[11] = value;
-    else if (address == "/gravity/block3/b1/colorize/hueBand5") gui->block1Colorize[12] = value;
-    else if (address == "/gravity/block3/b1/colorize/saturationBand5") gui->block1Colorize[13] = value;
-    else if (address == "/gravity/block3/b1/colorize/brightBand5") gui->block1Colorize[14] = value;
-
-    // BLOCK 3 - Block 1 Filters (5 parameters)
-    else if (address == "/gravity/block3/b1/blurAmount") gui->block1Filters[0] = value;
-    else if (address == "/gravity/block3/b1/blurRadius") gui->block1Filters[1] = value;
-    else if (address == "/gravity/block3/b1/sharpenAmount") gui->block1Filters[2] = value;
-    else if (address == "/gravity/block3/b1/sharpenRadius") gui->block1Filters[3] = value;
-    else if (address == "/gravity/block3/b1/filtersBoost") gui->block1Filters[4] = value;
-
-    // BLOCK 3 - Block 2 Geometry (10 parameters)
-    else if (address == "/gravity/block3/b2/xDisplace") gui->block2Geo[0] = value;
-    else if (address == "/gravity/block3/b2/yDisplace") gui->block2Geo[1] = value;
-    else if (address == "/gravity/block3/b2/zDisplace") gui->block2Geo[2] = value;
-    else if (address == "/gravity/block3/b2/rotate") gui->block2Geo[3] = value;
-    else if (address == "/gravity/block3/b2/xStretch") gui->block2Geo[4] = value;
-    else if (address == "/gravity/block3/b2/yStretch") gui->block2Geo[5] = value;
-    else if (address == "/gravity/block3/b2/xShear") gui->block2Geo[6] = value;
-    else if (address == "/gravity/block3/b2/yShear") gui->block2Geo[7] = value;
-    else if (address == "/gravity/block3/b2/kaleidoscopeAmount") gui->block2Geo[8] = value;
-    else if (address == "/gravity/block3/b2/kaleidoscopeSlice") gui->block2Geo[9] = value;
-
-    // BLOCK 3 - Block 2 Colorize (15 parameters)
-    else if (address == "/gravity/block3/b2/colorize/hueBand1") gui->block2Colorize[0] = value;
-    else if (address == "/gravity/block3/b2/colorize/saturationBand1") gui->block2Colorize[1] = value;
-    else if (address == "/gravity/block3/b2/colorize/brightBand1") gui->block2Colorize[2] = value;
-    else if (address == "/gravity/block3/b2/colorize/hueBand2") gui->block2Colorize[3] = value;
-    else if (address == "/gravity/block3/b2/colorize/saturationBand2") gui->block2Colorize[4] = value;
-    else if (address == "/gravity/block3/b2/colorize/brightBand2") gui->block2Colorize[5] = value;
-    else if (address == "/gravity/block3/b2/colorize/hueBand3") gui->block2Colorize[6] = value;
-    else if (address == "/gravity/block3/b2/colorize/saturationBand3") gui->block2Colorize[7] = value;
-    else if (address == "/gravity/block3/b2/colorize/brightBand3") gui->block2Colorize[8] = value;
-    else if (address == "/gravity/block3/b2/colorize/hueBand4") gui->block2Colorize[9] = value;
-    else if (address == "/gravity/block3/b2/colorize/saturationBand4") gui->block2Colorize[10] = value;
-    else if (address == "/gravity/block3/b2/colorize/brightBand4") gui->block2Colorize[11] = value;
-    else if (address == "/gravity/block3/b2/colorize/hueBand5") gui->block2Colorize[12] = value;
-    else if (address == "/gravity/block3/b2/colorize/saturationBand5") gui->block2Colorize[13] = value;
-    else if (address == "/gravity/block3/b2/colorize/brightBand5") gui->block2Colorize[14] = value;
-
-    // BLOCK 3 - Block 2 Filters (5 parameters)
-    else if (address == "/gravity/block3/b2/blurAmount") gui->block2Filters[0] = value;
-    else if (address == "/gravity/block3/b2/blurRadius") gui->block2Filters[1] = value;
-    else if (address == "/gravity/block3/b2/sharpenAmount") gui->block2Filters[2] = value;
-    else if (address == "/gravity/block3/b2/sharpenRadius") gui->block2Filters[3] = value;
-    else if (address == "/gravity/block3/b2/filtersBoost") gui->block2Filters[4] = value;
-
-    // BLOCK 3 - Matrix Mix (9 parameters)
-    else if (address == "/gravity/block3/matrixMix/b1RedToB2Red") gui->matrixMix[0] = value;
-    else if (address == "/gravity/block3/matrixMix/b1RedToB2Green") gui->matrixMix[1] = value;
-    else if (address == "/gravity/block3/matrixMix/b1RedToB2Blue") gui->matrixMix[2] = value;
-    else if (address == "/gravity/block3/matrixMix/b1GreenToB2Red") gui->matrixMix[3] = value;
-    else if (address == "/gravity/block3/matrixMix/b1GreenToB2Green") gui->matrixMix[4] = value;
-    else if (address == "/gravity/block3/matrixMix/b1GreenToB2Blue") gui->matrixMix[5] = value;
-    else if (address == "/gravity/block3/matrixMix/b1BlueToB2Red") gui->matrixMix[6] = value;
-    else if (address == "/gravity/block3/matrixMix/b1GreenToB2Blue") gui->matrixMix[7] = value;
-    else if (address == "/gravity/block3/matrixMix/b1BlueToB2Blue") gui->matrixMix[8] = value;
-
-    // BLOCK 3 - Final Mix and Key (6 parameters)
-    else if (address == "/gravity/block3/final/mixAmount") gui->finalMixAndKey[0] = value;
-    else if (address == "/gravity/block3/final/keyThreshold") gui->finalMixAndKey[4] = value;
-    else if (address == "/gravity/block3/final/keySoft") gui->finalMixAndKey[5] = value;
-    else if (address == "/gravity/block3/final/keyInvert") gui->finalMixAndKey[3] = value;
-    else if (address == "/gravity/block3/final/keyRed") gui->finalMixAndKey[1] = value;
-    else if (address == "/gravity/block3/final/keyGreen") gui->finalMixAndKey[2] = value;
+const std::vector<OscParameter*>& ofApp::resolveOscPattern(const string& address) {
+    auto it = oscPatternCache.find(address);
+    if (it != oscPatternCache.end()) return it->second.handles;
+
+    // Controllers normally reuse a handful of patterns; a flood of unique
+    // ones just restarts the cache instead of growing it forever
+    if (oscPatternCache.size() >= oscPatternCacheLimit) oscPatternCache.clear();
+
+    OscPatternEntry& entry = oscPatternCache[address];
+    if (!entry.pattern.compile(address)) {
+        ofLogWarning("OSC") << "Invalid address pattern: " << address;
+        return entry.handles;
+    }
 
-    else return false;
-    return true;
+    for (auto& param : gui->oscRegistry) {
+        if (entry.pattern.matches(param.address)) {
+            entry.handles.push_back(&param);
+        }
+    }
+
+    ofLogNotice("OSC") << "Pattern " << address << " matched " << entry.handles.size() << " parameters";
+    return entry.handles;
 }
 
 //--------------------------------------------------------------
-bool ofApp::processOscDiscreteParams(const string& address, const ofxOscMessage& m) {
-    // BLOCK 1 - Ch1 Discrete Parameters
-    if (address == "/gravity/block1/ch1/inputSelect") gui->ch1InputSelect = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/ch1/geoOverflow") gui->ch1GeoOverflow = m.getArgAsInt(0);
-
-    // BLOCK 1 - Ch2 Mix and Key Discrete Parameters
-    else if (address == "/gravity/block1/ch2/inputSelect") gui->ch2InputSelect = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/ch2/keyOrder") gui->ch2KeyOrder = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/ch2/mixType") gui->ch2MixType = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/ch2/mixOverflow") gui->ch2MixOverflow = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/ch2/keyMode") gui->ch2KeyMode = m.getArgAsInt(0);
-
-    // BLOCK 1 - Ch2 Adjust Discrete Parameters
-    else if (address == "/gravity/block1/ch2/geoOverflow") gui->ch2GeoOverflow = m.getArgAsInt(0);
-
-    // BLOCK 1 - FB1 Mix and Key Discrete Parameters
-    else if (address == "/gravity/block1/fb1/keyOrder") gui->fb1KeyOrder = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/fb1/mixType") gui->fb1MixType = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/fb1/mixOverflow") gui->fb1MixOverflow = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/fb1/keyMode") gui->fb1KeyMode = m.getArgAsInt(0);
-
-    // BLOCK 1 - FB1 Geometry Discrete Parameters
-    else if (address == "/gravity/block1/fb1/geoOverflow") gui->fb1GeoOverflow = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/fb1/delayTime") {
-        gui->fb1DelayTime = m.getArgAsInt(0);
-        // Send delay in seconds
+void ofApp::sendOscParameterEcho(const string& address) {
+    // Delay times also update the seconds readout
+    if (address == "/gravity/block1/fb1/delayTime") {
         float secDelay = (float)gui->fb1DelayTime / (float)gui->targetFPS;
         sendOscParameter("/gravity/block1/fb1/secDelay", roundf(secDelay * 100.0f) / 100.0f);
     }
-
-    // BLOCK 2 - Input Adjust Discrete Parameters
-    else if (address == "/gravity/block2/input/inputSelect") gui->block2InputSelect = m.getArgAsInt(0);
-    else if (address == "/gravity/block2/input/geoOverflow") gui->block2InputGeoOverflow = m.getArgAsInt(0);
-
-    // BLOCK 2 - FB2 Mix and Key Discrete Parameters
-    else if (address == "/gravity/block2/fb2/keyOrder") gui->fb2KeyOrder = m.getArgAsInt(0);
-    else if (address == "/gravity/block2/fb2/mixType") gui->fb2MixType = m.getArgAsInt(0);
-    else if (address == "/gravity/block2/fb2/mixOverflow") gui->fb2MixOverflow = m.getArgAsInt(0);
-    else if (address == "/gravity/block2/fb2/keyMode") gui->fb2KeyMode = m.getArgAsInt(0);
-
-    // BLOCK 2 - FB2 Geometry Discrete Parameters
-    else if (address == "/gravity/block2/fb2/geoOverflow") gui->fb2GeoOverflow = m.getArgAsInt(0);
     else if (address == "/gravity/block2/fb2/delayTime") {
-        gui->fb2DelayTime = m.getArgAsInt(0);
-        // Send delay in seconds
         float secDelay = (float)gui->fb2DelayTime / (float)gui->targetFPS;
         sendOscParameter("/gravity/block2/fb2/secDelay", roundf(secDelay * 100.0f) / 100.0f);
     }
+}
 
-    // BLOCK 3 - Block 1 Geometry Discrete Parameters
-    else if (address == "/gravity/block3/b1/geoOverflow") gui->block1GeoOverflow = m.getArgAsInt(0);
-    else if (address == "/gravity/block3/b1/rotateMode") gui->block1RotateMode = m.getArgAsInt(0);
-    else if (address == "/gravity/block3/b1/colorize/colorspace") gui->block1ColorizeHSB_RGB = m.getArgAsInt(0);
-
-    // BLOCK 3 - Block 2 Geometry Discrete Parameters
-    else if (address == "/gravity/block3/b2/geoOverflow") gui->block2GeoOverflow = m.getArgAsInt(0);
-    else if (address == "/gravity/block3/b2/rotateMode") gui->block2RotateMode = m.getArgAsInt(0);
-    else if (address == "/gravity/block3/b2/colorize/colorspace") gui->block2ColorizeHSB_RGB = m.getArgAsInt(0);
-
-    // BLOCK 3 - Matrix Mix Discrete Parameters
-    else if (address == "/gravity/block3/matrixMix/mixType") gui->matrixMixType = m.getArgAsInt(0);
-    else if (address == "/gravity/block3/matrixMix/overflow") gui->matrixMixOverflow = m.getArgAsInt(0);
-
-    // BLOCK 3 - Final Mix and Key Discrete Parameters
-    else if (address == "/gravity/block3/final/keyOrder") gui->finalKeyOrder = m.getArgAsInt(0);
-    else if (address == "/gravity/block3/final/mixType") gui->finalMixType = m.getArgAsInt(0);
-    else if (address == "/gravity/block3/final/overflow") gui->finalMixOverflow = m.getArgAsInt(0);
-    else if (address == "/gravity/block3/final/keyMode") gui->finalKeyMode = m.getArgAsInt(0);
-
-    // SETTINGS - Performance
-    else if (address == "/gravity/settings/fps") {
+//--------------------------------------------------------------
+bool ofApp::processOscSettingsCommands(const string& address, const ofxOscMessage& m) {
+    if (address == "/gravity/settings/fps") {
         int fps = m.getArgAsInt(0);
         if (fps < 1) fps = 1;
         if (fps > 60) fps = 60;
@@ -3430,355 +3209,6 @@ bool ofApp::processOscDiscreteParams(const string& address, const ofxOscMessage&
     return true;
 }
 
-//--------------------------------------------------------------
-bool ofApp::processOscBooleanParams(const string& address, const ofxOscMessage& m) {
-    // BLOCK 1 - Ch1 Adjust Boolean Parameters
-    if (address == "/gravity/block1/ch1/hMirror") gui->ch1HMirror = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/ch1/vMirror") gui->ch1VMirror = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/ch1/hFlip") gui->ch1HFlip = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/ch1/vFlip") gui->ch1VFlip = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/ch1/hueInvert") gui->ch1HueInvert = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/ch1/saturationInvert") gui->ch1SaturationInvert = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/ch1/brightInvert") gui->ch1BrightInvert = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/ch1/rgbInvert") gui->ch1RGBInvert = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/ch1/solarize") gui->ch1Solarize = m.getArgAsInt(0);
-
-    // BLOCK 1 - Ch2 Adjust Boolean Parameters
-    else if (address == "/gravity/block1/ch2/hMirror") gui->ch2HMirror = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/ch2/vMirror") gui->ch2VMirror = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/ch2/hFlip") gui->ch2HFlip = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/ch2/vFlip") gui->ch2VFlip = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/ch2/hueInvert") gui->ch2HueInvert = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/ch2/saturationInvert") gui->ch2SaturationInvert = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/ch2/brightInvert") gui->ch2BrightInvert = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/ch2/rgbInvert") gui->ch2RGBInvert = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/ch2/solarize") gui->ch2Solarize = m.getArgAsInt(0);
-
-    // BLOCK 1 - FB1 Geometry Boolean Parameters
-    else if (address == "/gravity/block1/fb1/hMirror") gui->fb1HMirror = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/fb1/vMirror") gui->fb1VMirror = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/fb1/hFlip") gui->fb1HFlip = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/fb1/vFlip") gui->fb1VFlip = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/fb1/rotateMode") gui->fb1RotateMode = m.getArgAsInt(0);
-
-    // BLOCK 1 - FB1 Geometrical Animations
-    else if (address == "/gravity/block1/fb1/hypercube") gui->block1HypercubeSwitch = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/fb1/dancingLine") gui->block1LineSwitch = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/fb1/septagram") gui->block1SevenStarSwitch = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/fb1/lissajousBall") gui->block1LissaBallSwitch = m.getArgAsInt(0);
-
-    // BLOCK 1 - FB1 Color Boolean Parameters
-    else if (address == "/gravity/block1/fb1/hueInvert") gui->fb1HueInvert = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/fb1/saturationInvert") gui->fb1SaturationInvert = m.getArgAsInt(0);
-    else if (address == "/gravity/block1/fb1/brightInvert") gui->fb1BrightInvert = m.getArgAsInt(0);
-
-    // BLOCK 2 - Input Adjust Boolean Parameters
-    else if (address == "/gravity/block2/input/hMirror") gui->block2InputHMirror = m.getArgAsInt(0);
-    else if (address == "/gravity/block2/input/vMirror") gui->block2InputVMirror = m.getArgAsInt(0);
-    else if (address == "/gravity/block2/input/hFlip") gui->block2InputHFlip = m.getArgAsInt(0);
-    else if (address == "/gravity/block2/input/vFlip") gui->block2InputVFlip = m.getArgAsInt(0);
-    else if (address == "/gravity/block2/input/hueInvert") gui->block2InputHueInvert = m.getArgAsInt(0);
-    else if (address == "/gravity/block2/input/saturationInvert") gui->block2InputSaturationInvert = m.getArgAsInt(0);
-    else if (address == "/gravity/block2/input/brightInvert") gui->block2InputBrightInvert = m.getArgAsInt(0);
-    else if (address == "/gravity/block2/input/rgbInvert") gui->block2InputRGBInvert = m.getArgAsInt(0);
-    else if (address == "/gravity/block2/input/solarize") gui->block2InputSolarize = m.getArgAsInt(0);
-
-    // BLOCK 2 - FB2 Geometry Boolean Parameters
-    else if (address == "/gravity/block2/fb2/hMirror") gui->fb2HMirror = m.getArgAsInt(0);
-    else if (address == "/gravity/block2/fb2/vMirror") gui->fb2VMirror = m.getArgAsInt(0);
-    else if (address == "/gravity/block2/fb2/hFlip") gui->fb2HFlip = m.getArgAsInt(0);
-    else if (address == "/gravity/block2/fb2/vFlip") gui->fb2VFlip = m.getArgAsInt(0);
-    else if (address == "/gravity/block2/fb2/rotateMode") gui->fb2RotateMode = m.getArgAsInt(0);
-
-    // BLOCK 2 - FB2 Geometrical Animations
-    else if (address == "/gravity/block2/fb2/hypercube") gui->block2HypercubeSwitch = m.getArgAsInt(0);
-    else if (address == "/gravity/block2/fb2/dancingLine") gui->block2LineSwitch = m.getArgAsInt(0);
-    else if (address == "/gravity/block2/fb2/septagram") gui->block2SevenStarSwitch = m.getArgAsInt(0);
-    else if (address == "/gravity/block2/fb2/lissajousBall") gui->block2LissaBallSwitch = m.getArgAsInt(0);
-
-    // BLOCK 2 - FB2 Color Boolean Parameters
-    else if (address == "/gravity/block2/fb2/hueInvert") gui->fb2HueInvert = m.getArgAsInt(0);
-    else if (address == "/gravity/block2/fb2/saturationInvert") gui->fb2SaturationInvert = m.getArgAsInt(0);
-    else if (address == "/gravity/block2/fb2/brightInvert") gui->fb2BrightInvert = m.getArgAsInt(0);
-
-    // BLOCK 3 - Block 1 Geometry Boolean Parameters
-    else if (address == "/gravity/block3/b1/hMirror") gui->block1HMirror = m.getArgAsInt(0);
-    else if (address == "/gravity/block3/b1/vMirror") gui->block1VMirror = m.getArgAsInt(0);
-    else if (address == "/gravity/block3/b1/hFlip") gui->block1HFlip = m.getArgAsInt(0);
-    else if (address == "/gravity/block3/b1/vFlip") gui->block1VFlip = m.getArgAsInt(0);
-
-    // BLOCK 3 - Block 2 Geometry Boolean Parameters
-    else if (address == "/gravity/block3/b2/hMirror") gui->block2HMirror = m.getArgAsInt(0);
-    else if (address == "/gravity/block3/b2/vMirror") gui->block2VMirror = m.getArgAsInt(0);
-    else if (address == "/gravity/block3/b2/hFlip") gui->block2HFlip = m.getArgAsInt(0);
-    else if (address == "/gravity/block3/b2/vFlip") gui->block2VFlip = m.getArgAsInt(0);
-
-    // BLOCK 3 - Color EQ Boolean Parameters
-    else if (address == "/gravity/block3/b1/colorize/active") gui->block1ColorizeSwitch = m.getArgAsInt(0);
-    else if (address == "/gravity/block3/b2/colorize/active") gui->block2ColorizeSwitch = m.getArgAsInt(0);
-
-    else return false;
-    return true;
-}
-
-//--------------------------------------------------------------
-bool ofApp::processOscLfoParamsFb(const string& address, float value) {
-    // FB1 Mix and Key LFO (6 parameters)
-    if (address == "/gravity/block1/fb1/lfo/mixAmountAmp") gui->fb1MixAndKeyLfo[0] = value;
-    else if (address == "/gravity/block1/fb1/lfo/mixAmountRate") gui->fb1MixAndKeyLfo[1] = value;
-    else if (address == "/gravity/block1/fb1/lfo/keyThresholdAmp") gui->fb1MixAndKeyLfo[2] = value;
-    else if (address == "/gravity/block1/fb1/lfo/keyThresholdRate") gui->fb1MixAndKeyLfo[3] = value;
-    else if (address == "/gravity/block1/fb1/lfo/keySoftAmp") gui->fb1MixAndKeyLfo[4] = value;
-    else if (address == "/gravity/block1/fb1/lfo/keySoftRate") gui->fb1MixAndKeyLfo[5] = value;
-
-    // FB1 Geometry LFO 1 (8 parameters)
-    else if (address == "/gravity/block1/fb1/lfo/xDisplaceAmp") gui->fb1Geo1Lfo1[0] = value;
-    else if (address == "/gravity/block1/fb1/lfo/xDisplaceRate") gui->fb1Geo1Lfo1[1] = value;
-    else if (address == "/gravity/block1/fb1/lfo/yDisplaceAmp") gui->fb1Geo1Lfo1[2] = value;
-    else if (address == "/gravity/block1/fb1/lfo/yDisplaceRate") gui->fb1Geo1Lfo1[3] = value;
-    else if (address == "/gravity/block1/fb1/lfo/zDisplaceAmp") gui->fb1Geo1Lfo1[4] = value;
-    else if (address == "/gravity/block1/fb1/lfo/zDisplaceRate") gui->fb1Geo1Lfo1[5] = value;
-    else if (address == "/gravity/block1/fb1/lfo/rotateAmp") gui->fb1Geo1Lfo1[6] = value;
-    else if (address == "/gravity/block1/fb1/lfo/rotateRate") gui->fb1Geo1Lfo1[7] = value;
-
-    // FB1 Geometry LFO 2 (10 parameters)
-    else if (address == "/gravity/block1/fb1/lfo/xStretchAmp") gui->fb1Geo1Lfo2[0] = value;
-    else if (address == "/gravity/block1/fb1/lfo/xStretchRate") gui->fb1Geo1Lfo2[1] = value;
-    else if (address == "/gravity/block1/fb1/lfo/yStretchAmp") gui->fb1Geo1Lfo2[2] = value;
-    else if (address == "/gravity/block1/fb1/lfo/yStretchRate") gui->fb1Geo1Lfo2[3] = value;
-    else if (address == "/gravity/block1/fb1/lfo/xShearAmp") gui->fb1Geo1Lfo2[4] = value;
-    else if (address == "/gravity/block1/fb1/lfo/xShearRate") gui->fb1Geo1Lfo2[5] = value;
-    else if (address == "/gravity/block1/fb1/lfo/yShearAmp") gui->fb1Geo1Lfo2[6] = value;
-    else if (address == "/gravity/block1/fb1/lfo/yShearRate") gui->fb1Geo1Lfo2[7] = value;
-    else if (address == "/gravity/block1/fb1/lfo/kaleidoscopeSliceAmp") gui->fb1Geo1Lfo2[8] = value;
-    else if (address == "/gravity/block1/fb1/lfo/kaleidoscopeSliceRate") gui->fb1Geo1Lfo2[9] = value;
-
-    // FB1 Color LFO (6 parameters)
-    else if (address == "/gravity/block1/fb1/lfo/huePowmapAmp") gui->fb1Color1Lfo1[0] = value;
-    else if (address == "/gravity/block1/fb1/lfo/huePowmapRate") gui->fb1Color1Lfo1[1] = value;
-    else if (address == "/gravity/block1/fb1/lfo/saturationPowmapAmp") gui->fb1Color1Lfo1[2] = value;
-    else if (address == "/gravity/block1/fb1/lfo/saturationPowmapRate") gui->fb1Color1Lfo1[3] = value;
-    else if (address == "/gravity/block1/fb1/lfo/brightPowmapAmp") gui->fb1Color1Lfo1[4] = value;
-    else if (address == "/gravity/block1/fb1/lfo/brightPowmapRate") gui->fb1Color1Lfo1[5] = value;
-
-    // FB2 Mix and Key LFO (6 parameters)
-    else if (address == "/gravity/block2/fb2/lfo/mixAmountAmp") gui->fb2MixAndKeyLfo[0] = value;
-    else if (address == "/gravity/block2/fb2/lfo/mixAmountRate") gui->fb2MixAndKeyLfo[1] = value;
-    else if (address == "/gravity/block2/fb2/lfo/keyThresholdAmp") gui->fb2MixAndKeyLfo[2] = value;
-    else if (address == "/gravity/block2/fb2/lfo/keyThresholdRate") gui->fb2MixAndKeyLfo[3] = value;
-    else if (address == "/gravity/block2/fb2/lfo/keySoftAmp") gui->fb2MixAndKeyLfo[4] = value;
-    else if (address == "/gravity/block2/fb2/lfo/keySoftRate") gui->fb2MixAndKeyLfo[5] = value;
-
-    // FB2 Geometry LFO 1 (8 parameters)
-    else if (address == "/gravity/block2/fb2/lfo/xDisplaceAmp") gui->fb2Geo1Lfo1[0] = value;
-    else if (address == "/gravity/block2/fb2/lfo/xDisplaceRate") gui->fb2Geo1Lfo1[1] = value;
-    else if (address == "/gravity/block2/fb2/lfo/yDisplaceAmp") gui->fb2Geo1Lfo1[2] = value;
-    else if (address == "/gravity/block2/fb2/lfo/yDisplaceRate") gui->fb2Geo1Lfo1[3] = value;
-    else if (address == "/gravity/block2/fb2/lfo/zDisplaceAmp") gui->fb2Geo1Lfo1[4] = value;
-    else if (address == "/gravity/block2/fb2/lfo/zDisplaceRate") gui->fb2Geo1Lfo1[5] = value;
-    else if (address == "/gravity/block2/fb2/lfo/rotateAmp") gui->fb2Geo1Lfo1[6] = value;
-    else if (address == "/gravity/block2/fb2/lfo/rotateRate") gui->fb2Geo1Lfo1[7] = value;
-
-    // FB2 Geometry LFO 2 (10 parameters)
-    else if (address == "/gravity/block2/fb2/lfo/xStretchAmp") gui->fb2Geo1Lfo2[0] = value;
-    else if (address == "/gravity/block2/fb2/lfo/xStretchRate") gui->fb2Geo1Lfo2[1] = value;
-    else if (address == "/gravity/block2/fb2/lfo/yStretchAmp") gui->fb2Geo1Lfo2[2] = value;
-    else if (address == "/gravity/block2/fb2/lfo/yStretchRate") gui->fb2Geo1Lfo2[3] = value;
-    else if (address == "/gravity/block2/fb2/lfo/xShearAmp") gui->fb2Geo1Lfo2[4] = value;
-    else if (address == "/gravity/block2/fb2/lfo/xShearRate") gui->fb2Geo1Lfo2[5] = value;
-    else if (address == "/gravity/block2/fb2/lfo/yShearAmp") gui->fb2Geo1Lfo2[6] = value;
-    else if (address == "/gravity/block2/fb2/lfo/yShearRate") gui->fb2Geo1Lfo2[7] = value;
-    else if (address == "/gravity/block2/fb2/lfo/kaleidoscopeSliceAmp") gui->fb2Geo1Lfo2[8] = value;
-    else if (address == "/gravity/block2/fb2/lfo/kaleidoscopeSliceRate") gui->fb2Geo1Lfo2[9] = value;
-
-    // FB2 Color LFO (6 parameters)
-    else if (address == "/gravity/block2/fb2/lfo/huePowmapAmp") gui->fb2Color1Lfo1[0] = value;
-    else if (address == "/gravity/block2/fb2/lfo/huePowmapRate") gui->fb2Color1Lfo1[1] = value;
-    else if (address == "/gravity/block2/fb2/lfo/saturationPowmapAmp") gui->fb2Color1Lfo1[2] = value;
-    else if (address == "/gravity/block2/fb2/lfo/saturationPowmapRate") gui->fb2Color1Lfo1[3] = value;
-    else if (address == "/gravity/block2/fb2/lfo/brightPowmapAmp") gui->fb2Color1Lfo1[4] = value;
-    else if (address == "/gravity/block2/fb2/lfo/brightPowmapRate") gui->fb2Color1Lfo1[5] = value;
-
-    // Block 2 Input Adjust LFO (16 parameters)
-    else if (address == "/gravity/block2/input/lfo/xDisplaceAmp") gui->block2InputAdjustLfo[0] = value;
-    else if (address == "/gravity/block2/input/lfo/xDisplaceRate") gui->block2InputAdjustLfo[1] = value;
-    else if (address == "/gravity/block2/input/lfo/yDisplaceAmp") gui->block2InputAdjustLfo[2] = value;
-    else if (address == "/gravity/block2/input/lfo/yDisplaceRate") gui->block2InputAdjustLfo[3] = value;
-    else if (address == "/gravity/block2/input/lfo/zDisplaceAmp") gui->block2InputAdjustLfo[4] = value;
-    else if (address == "/gravity/block2/input/lfo/zDisplaceRate") gui->block2InputAdjustLfo[5] = value;
-    else if (address == "/gravity/block2/input/lfo/rotateAmp") gui->block2InputAdjustLfo[6] = value;
-    else if (address == "/gravity/block2/input/lfo/rotateRate") gui->block2InputAdjustLfo[7] = value;
-    else if (address == "/gravity/block2/input/lfo/hueOffsetAmp") gui->block2InputAdjustLfo[8] = value;
-    else if (address == "/gravity/block2/input/lfo/hueOffsetRate") gui->block2InputAdjustLfo[9] = value;
-    else if (address == "/gravity/block2/input/lfo/saturationOffsetAmp") gui->block2InputAdjustLfo[10] = value;
-    else if (address == "/gravity/block2/input/lfo/saturationOffsetRate") gui->block2InputAdjustLfo[11] = value;
-    else if (address == "/gravity/block2/input/lfo/brightOffsetAmp") gui->block2InputAdjustLfo[12] = value;
-    else if (address == "/gravity/block2/input/lfo/brightOffsetRate") gui->block2InputAdjustLfo[13] = value;
-    else if (address == "/gravity/block2/input/lfo/kaleidoscopeSliceAmp") gui->block2InputAdjustLfo[14] = value;
-    else if (address == "/gravity/block2/input/lfo/kaleidoscopeSliceRate") gui->block2InputAdjustLfo[15] = value;
-
-    else return false;
-    return true;
-}
-
-//--------------------------------------------------------------
-bool ofApp::processOscLfoParamsBlock3B1(const string& address, float value) {
-    // Block3 B1 Colorize LFO 1 (12 parameters)
-    if (address == "/gravity/block3/lfo/b1/hueBand1Amp") gui->block1ColorizeLfo1[0] = value;
-    else if (address == "/gravity/block3/lfo/b1/saturationBand1Amp") gui->block1ColorizeLfo1[1] = value;
-    else if (address == "/gravity/block3/lfo/b1/brightBand1Amp") gui->block1ColorizeLfo1[2] = value;
-    else if (address == "/gravity/block3/lfo/b1/hueBand1Rate") gui->block1ColorizeLfo1[3] = value;
-    else if (address == "/gravity/block3/lfo/b1/saturationBand1Rate") gui->block1ColorizeLfo1[4] = value;
-    else if (address == "/gravity/block3/lfo/b1/brightBand1Rate") gui->block1ColorizeLfo1[5] = value;
-    else if (address == "/gravity/block3/lfo/b1/hueBand2Amp") gui->block1ColorizeLfo1[6] = value;
-    else if (address == "/gravity/block3/lfo/b1/saturationBand2Amp") gui->block1ColorizeLfo1[7] = value;
-    else if (address == "/gravity/block3/lfo/b1/brightBand2Amp") gui->block1ColorizeLfo1[8] = value;
-    else if (address == "/gravity/block3/lfo/b1/hueBand2Rate") gui->block1ColorizeLfo1[9] = value;
-    else if (address == "/gravity/block3/lfo/b1/saturationBand2Rate") gui->block1ColorizeLfo1[10] = value;
-    else if (address == "/gravity/block3/lfo/b1/brightBand2Rate") gui->block1ColorizeLfo1[11] = value;
-
-    // Block3 B1 Colorize LFO 2 (12 parameters)
-    else if (address == "/gravity/block3/lfo/b1/hueBand3Amp") gui->block1ColorizeLfo2[0] = value;
-    else if (address == "/gravity/block3/lfo/b1/saturationBand3Amp") gui->block1ColorizeLfo2[1] = value;
-    else if (address == "/gravity/block3/lfo/b1/brightBand3Amp") gui->block1ColorizeLfo2[2] = value;
-    else if (address == "/gravity/block3/lfo/b1/hueBand3Rate") gui->block1ColorizeLfo2[3] = value;
-    else if (address == "/gravity/block3/lfo/b1/saturationBand3Rate") gui->block1ColorizeLfo2[4] = value;
-    else if (address == "/gravity/block3/lfo/b1/brightBand3Rate") gui->block1ColorizeLfo2[5] = value;
-    else if (address == "/gravity/block3/lfo/b1/hueBand4Amp") gui->block1ColorizeLfo2[6] = value;
-    else if (address == "/gravity/block3/lfo/b1/saturationBand4Amp") gui->block1ColorizeLfo2[7] = value;
-    else if (address == "/gravity/block3/lfo/b1/brightBand4Amp") gui->block1ColorizeLfo2[8] = value;
-    else if (address == "/gravity/block3/lfo/b1/hueBand4Rate") gui->block1ColorizeLfo2[9] = value;
-    else if (address == "/gravity/block3/lfo/b1/saturationBand4Rate") gui->block1ColorizeLfo2[10] = value;
-    else if (address == "/gravity/block3/lfo/b1/brightBand4Rate") gui->block1ColorizeLfo2[11] = value;
-
-    // Block3 B1 Colorize LFO 3 (6 parameters)
-    else if (address == "/gravity/block3/lfo/b1/hueBand5Amp") gui->block1ColorizeLfo3[0] = value;
-    else if (address == "/gravity/block3/lfo/b1/saturationBand5Amp") gui->block1ColorizeLfo3[1] = value;
-    else if (address == "/gravity/block3/lfo/b1/brightBand5Amp") gui->block1ColorizeLfo3[2] = value;
-    else if (address == "/gravity/block3/lfo/b1/hueBand5Rate") gui->block1ColorizeLfo3[3] = value;
-    else if (address == "/gravity/block3/lfo/b1/saturationBand5Rate") gui->block1ColorizeLfo3[4] = value;
-    else if (address == "/gravity/block3/lfo/b1/brightBand5Rate") gui->block1ColorizeLfo3[5] = value;
-
-    // Block3 B1 Geo LFO 1 (8 parameters)
-    else if (address == "/gravity/block3/lfo/b1/xDisplaceAmp") gui->block1Geo1Lfo1[0] = value;
-    else if (address == "/gravity/block3/lfo/b1/xDisplaceRate") gui->block1Geo1Lfo1[1] = value;
-    else if (address == "/gravity/block3/lfo/b1/yDisplaceAmp") gui->block1Geo1Lfo1[2] = value;
-    else if (address == "/gravity/block3/lfo/b1/yDisplaceRate") gui->block1Geo1Lfo1[3] = value;
-    else if (address == "/gravity/block3/lfo/b1/zDisplaceAmp") gui->block1Geo1Lfo1[4] = value;
-    else if (address == "/gravity/block3/lfo/b1/zDisplaceRate") gui->block1Geo1Lfo1[5] = value;
-    else if (address == "/gravity/block3/lfo/b1/rotateAmp") gui->block1Geo1Lfo1[6] = value;
-    else if (address == "/gravity/block3/lfo/b1/rotateRate") gui->block1Geo1Lfo1[7] = value;
-
-    // Block3 B1 Geo LFO 2 (10 parameters)
-    else if (address == "/gravity/block3/lfo/b1/xStretchAmp") gui->block1Geo1Lfo2[0] = value;
-    else if (address == "/gravity/block3/lfo/b1/xStretchRate") gui->block1Geo1Lfo2[1] = value;
-    else if (address == "/gravity/block3/lfo/b1/yStretchAmp") gui->block1Geo1Lfo2[2] = value;
-    else if (address == "/gravity/block3/lfo/b1/yStretchRate") gui->block1Geo1Lfo2[3] = value;
-    else if (address == "/gravity/block3/lfo/b1/xShearAmp") gui->block1Geo1Lfo2[4] = value;
-    else if (address == "/gravity/block3/lfo/b1/xShearRate") gui->block1Geo1Lfo2[5] = value;
-    else if (address == "/gravity/block3/lfo/b1/yShearAmp") gui->block1Geo1Lfo2[6] = value;
-    else if (address == "/gravity/block3/lfo/b1/yShearRate") gui->block1Geo1Lfo2[7] = value;
-    else if (address == "/gravity/block3/lfo/b1/kaleidoscopeSliceAmp") gui->block1Geo1Lfo2[8] = value;
-    else if (address == "/gravity/block3/lfo/b1/kaleidoscopeSliceRate") gui->block1Geo1Lfo2[9] = value;
-
-    else return false;
-    return true;
-}
-
-//--------------------------------------------------------------
-bool ofApp::processOscLfoParamsBlock3B2AndMatrix(const string& address, float value) {
-    // Block3 B2 Colorize LFO 1 (12 parameters)
-    if (address == "/gravity/block3/lfo/b2/hueBand1Amp") gui->block2ColorizeLfo1[0] = value;
-    else if (address == "/gravity/block3/lfo/b2/saturationBand1Amp") gui->block2ColorizeLfo1[1] = value;
-    else if (address == "/gravity/block3/lfo/b2/brightBand1Amp") gui->block2ColorizeLfo1[2] = value;
-    else if (address == "/gravity/block3/lfo/b2/hueBand1Rate") gui->block2ColorizeLfo1[3] = value;
-    else if (address == "/gravity/block3/lfo/b2/saturationBand1Rate") gui->block2ColorizeLfo1[4] = value;
-    else if (address == "/gravity/block3/lfo/b2/brightBand1Rate") gui->block2ColorizeLfo1[5] = value;
-    else if (address == "/gravity/block3/lfo/b2/hueBand2Amp") gui->block2ColorizeLfo1[6] = value;
-    else if (address == "/gravity/block3/lfo/b2/saturationBand2Amp") gui->block2ColorizeLfo1[7] = value;
-    else if (address == "/gravity/block3/lfo/b2/brightBand2Amp") gui->block2ColorizeLfo1[8] = value;
-    else if (address == "/gravity/block3/lfo/b2/hueBand2Rate") gui->block2ColorizeLfo1[9] = value;
-    else if (address == "/gravity/block3/lfo/b2/saturationBand2Rate") gui->block2ColorizeLfo1[10] = value;
-    else if (address == "/gravity/block3/lfo/b2/brightBand2Rate") gui->block2ColorizeLfo1[11] = value;
-
-    // Block3 B2 Colorize LFO 2 (12 parameters)
-    else if (address == "/gravity/block3/lfo/b2/hueBand3Amp") gui->block2ColorizeLfo2[0] = value;
-    else if (address == "/gravity/block3/lfo/b2/saturationBand3Amp") gui->block2ColorizeLfo2[1] = value;
-    else if (address == "/gravity/block3/lfo/b2/brightBand3Amp") gui->block2ColorizeLfo2[2] = value;
-    else if (address == "/gravity/block3/lfo/b2/hueBand3Rate") gui->block2ColorizeLfo2[3] = value;
-    else if (address == "/gravity/block3/lfo/b2/saturationBand3Rate") gui->block2ColorizeLfo2[4] = value;
-    else if (address == "/gravity/block3/lfo/b2/brightBand3Rate") gui->block2ColorizeLfo2[5] = value;
-    else if (address == "/gravity/block3/lfo/b2/hueBand4Amp") gui->block2ColorizeLfo2[6] = value;
-    else if (address == "/gravity/block3/lfo/b2/saturationBand4Amp") gui->block2ColorizeLfo2[7] = value;
-    else if (address == "/gravity/block3/lfo/b2/brightBand4Amp") gui->block2ColorizeLfo2[8] = value;
-    else if (address == "/gravity/block3/lfo/b2/hueBand4Rate") gui->block2ColorizeLfo2[9] = value;
-    else if (address == "/gravity/block3/lfo/b2/saturationBand4Rate") gui->block2ColorizeLfo2[10] = value;
-    else if (address == "/gravity/block3/lfo/b2/brightBand4Rate") gui->block2ColorizeLfo2[11] = value;
-
-    // Block3 B2 Colorize LFO 3 (6 parameters)
-    else if (address == "/gravity/block3/lfo/b2/hueBand5Amp") gui->block2ColorizeLfo3[0] = value;
-    else if (address == "/gravity/block3/lfo/b2/saturationBand5Amp") gui->block2ColorizeLfo3[1] = value;
-    else if (address == "/gravity/block3/lfo/b2/brightBand5Amp") gui->block2ColorizeLfo3[2] = value;
-    else if (address == "/gravity/block3/lfo/b2/hueBand5Rate") gui->block2ColorizeLfo3[3] = value;
-    else if (address == "/gravity/block3/lfo/b2/saturationBand5Rate") gui->block2ColorizeLfo3[4] = value;
-    else if (address == "/gravity/block3/lfo/b2/brightBand5Rate") gui->block2ColorizeLfo3[5] = value;
-
-    // Block3 B2 Geo LFO 1 (8 parameters)
-    else if (address == "/gravity/block3/lfo/b2/xDisplaceAmp") gui->block2Geo1Lfo1[0] = value;
-    else if (address == "/gravity/block3/lfo/b2/xDisplaceRate") gui->block2Geo1Lfo1[1] = value;
-    else if (address == "/gravity/block3/lfo/b2/yDisplaceAmp") gui->block2Geo1Lfo1[2] = value;
-    else if (address == "/gravity/block3/lfo/b2/yDisplaceRate") gui->block2Geo1Lfo1[3] = value;
-    else if (address == "/gravity/block3/lfo/b2/zDisplaceAmp") gui->block2Geo1Lfo1[4] = value;
-    else if (address == "/gravity/block3/lfo/b2/zDisplaceRate") gui->block2Geo1Lfo1[5] = value;
-    else if (address == "/gravity/block3/lfo/b2/rotateAmp") gui->block2Geo1Lfo1[6] = value;
-    else if (address == "/gravity/block3/lfo/b2/rotateRate") gui->block2Geo1Lfo1[7] = value;
-
-    // Block3 B2 Geo LFO 2 (10 parameters)
-    else if (address == "/gravity/block3/lfo/b2/xStretchAmp") gui->block2Geo1Lfo2[0] = value;
-    else if (address == "/gravity/block3/lfo/b2/xStretchRate") gui->block2Geo1Lfo2[1] = value;
-    else if (address == "/gravity/block3/lfo/b2/yStretchAmp") gui->block2Geo1Lfo2[2] = value;
-    else if (address == "/gravity/block3/lfo/b2/yStretchRate") gui->block2Geo1Lfo2[3] = value;
-    else if (address == "/gravity/block3/lfo/b2/xShearAmp") gui->block2Geo1Lfo2[4] = value;
-    else if (address == "/gravity/block3/lfo/b2/xShearRate") gui->block2Geo1Lfo2[5] = value;
-    else if (address == "/gravity/block3/lfo/b2/yShearAmp") gui->block2Geo1Lfo2[6] = value;
-    else if (address == "/gravity/block3/lfo/b2/yShearRate") gui->block2Geo1Lfo2[7] = value;
-    else if (address == "/gravity/block3/lfo/b2/kaleidoscopeSliceAmp") gui->block2Geo1Lfo2[8] = value;
-    else if (address == "/gravity/block3/lfo/b2/kaleidoscopeSliceRate") gui->block2Geo1Lfo2[9] = value;
-
-    // Final Mix and Key LFO (6 parameters)
-    else if (address == "/gravity/block3/lfo/final/mixAmountAmp") gui->finalMixAndKeyLfo[0] = value;
-    else if (address == "/gravity/block3/lfo/final/mixAmountRate") gui->finalMixAndKeyLfo[1] = value;
-    else if (address == "/gravity/block3/lfo/final/keyThresholdAmp") gui->finalMixAndKeyLfo[2] = value;
-    else if (address == "/gravity/block3/lfo/final/keyThresholdRate") gui->finalMixAndKeyLfo[3] = value;
-    else if (address == "/gravity/block3/lfo/final/keySoftAmp") gui->finalMixAndKeyLfo[4] = value;
-    else if (address == "/gravity/block3/lfo/final/keySoftRate") gui->finalMixAndKeyLfo[5] = value;
-
-    // Matrix Mix LFO 1 (12 parameters)
-    else if (address == "/gravity/block3/lfo/matrixMix/b1RedToB2RedAmp") gui->matrixMixLfo1[0] = value;
-    else if (address == "/gravity/block3/lfo/matrixMix/b1RedToB2GreenAmp") gui->matrixMixLfo1[1] = value;
-    else if (address == "/gravity/block3/lfo/matrixMix/b1RedToB2BlueAmp") gui->matrixMixLfo1[2] = value;
-    else if (address == "/gravity/block3/lfo/matrixMix/b1RedToB2RedRate") gui->matrixMixLfo1[3] = value;
-    else if (address == "/gravity/block3/lfo/matrixMix/b1RedToB2GreenRate") gui->matrixMixLfo1[4] = value;
-    else if (address == "/gravity/block3/lfo/matrixMix/b1RedToB2BlueRate") gui->matrixMixLfo1[5] = value;
-    else if (address == "/gravity/block3/lfo/matrixMix/b1GreenToB2RedAmp") gui->matrixMixLfo1[6] = value;
-    else if (address == "/gravity/block3/lfo/matrixMix/b1GreenToB2GreenAmp") gui->matrixMixLfo1[7] = value;
-    else if (address == "/gravity/block3/lfo/matrixMix/b1GreenToB2BlueAmp") gui->matrixMixLfo1[8] = value;
-    else if (address == "/gravity/block3/lfo/matrixMix/b1GreenToB2RedRate") gui->matrixMixLfo1[9] = value;
-    else if (address == "/gravity/block3/lfo/matrixMix/b1GreenToB2GreenRate") gui->matrixMixLfo1[10] = value;
-    else if (address == "/gravity/block3/lfo/matrixMix/b1GreenToB2BlueRate") gui->matrixMixLfo1[11] = value;
-
-    // Matrix Mix LFO 2 (6 parameters)
-    else if (address == "/gravity/block3/lfo/matrixMix/b1BlueToB2RedAmp") gui->matrixMixLfo2[0] = value;
-    else if (address == "/gravity/block3/lfo/matrixMix/b1BlueToB2GreenAmp") gui->matrixMixLfo2[1] = value;
-    else if (address == "/gravity/block3/lfo/matrixMix/b1BlueToB2BlueAmp") gui->matrixMixLfo2[2] = value;
-    else if (address == "/gravity/block3/lfo/matrixMix/b1BlueToB2RedRate") gui->matrixMixLfo2[3] = value;
-    else if (address == "/gravity/block3/lfo/matrixMix/b1BlueToB2GreenRate") gui->matrixMixLfo2[4] = value;
-    else if (address == "/gravity/block3/lfo/matrixMix/b1BlueToB2BlueRate") gui->matrixMixLfo2[5] = value;
-
-    else return false;
-    return true;
-}
-
 //--------------------------------------------------------------
 bool ofApp::processOscResetCommands(const string& address) {
     // BLOCK 1 Resets
@@ -3879,6 +3309,21 @@ bool ofApp::processOscPresetCommands(const string& address, const ofxOscMessage&
     else if (address == "/gravity/preset/save") {
         gui->saveALL = 1;
     }
+    // Glide to a load preset: [preset index] [time ms] [curve], all optional;
+    // a negative index morphs to the selected preset
+    else if (address == "/gravity/preset/morph") {
+        if (m.getNumArgs() > 0) {
+            int presetIndex = static_cast<int>(m.getArgAsFloat(0));
+            if (presetIndex >= 0) gui->loadStateSelectSwitch = presetIndex;
+        }
+        if (m.getNumArgs() > 1) {
+            gui->morphTimeMs = std::max(0.0f, m.getArgAsFloat(1));
+        }
+        if (m.getNumArgs() > 2) {
+            gui->morphCurve = ofClamp(static_cast<int>(m.getArgAsFloat(2)), 0, ParameterMorph::CURVE_COUNT - 1);
+        }
+        gui->morphALL = 1;
+    }
     // Bank switching commands - Save Bank
     else if (address == "/gravity/preset/saveBank/index") {
         if (m.getNumArgs() > 0) {
@@ -3919,10 +3364,13 @@ bool ofApp::processOscPresetCommands(const string& address, const ofxOscMessage&
     else if (address == "/gravity/preset/saveAs") {
         if (m.getNumArgs() > 0 && m.getArgType(0) == OFXOSC_TYPE_STRING) {
             std::string presetName = m.getArgAsString(0);
-            gui->saveALL = 1;  // Populate saveBuffer
             gui->savePresetAs(presetName);
         }
     }
+    // Write binary copies of the presets in the load bank
+    else if (address == "/gravity/preset/convertBank") {
+        gui->convertBankToBinary(gui->loadBankPath);
+    }
     // UI Scale control
     else if (address == "/gravity/ui/scale") {
         if (m.getNumArgs() > 0) {
@@ -3957,6 +3405,8 @@ void ofApp::sendOscString(string address, string value) {
 //--------------------------------------------------------------
 void ofApp::reloadOscSettings() {
     oscReceiver.stop();
+    oscReceiver.clearTimedMessages();
+    oscSchedule.clear();
     oscSender.clear();
     setupOsc();
     ofLogNotice("OSC") << "OSC settings reloaded";
@@ -3,6 +3,16 @@
 #include "ofMain.h"
 #include "GuiApp.h"
 #include "ofxOsc.h"
+#include "OscAddressPattern.h"
+#include "OscBundleReceiver.h"
+#include "GeneratorBatch.h"
+#include "ParticleGenerator.h"
+#include "FilterPrepass.h"
+#include "ColorizeLut.h"
+#include "CachedShader.h"
+#include "ResolutionGovernor.h"
+#include "Upscaler.h"
+#include <unordered_map>
 #include "ofxNDIreceiver.h"
 #include "ofxNDIsender.h"
 
@@ -21,6 +31,7 @@ class ofApp : public ofBaseApp{
 		void setup();
 		void update();
 		void draw();
+		void exit();
 
 		void keyPressed(int key);
 		void keyReleased(int key);
@@ -30,10 +41,11 @@ class ofApp : public ofBaseApp{
 		shared_ptr<ofAppBaseWindow> mainWindow;  // Reference to output window
 
 		// OSC Communication
-		ofxOscReceiver oscReceiver;
+		OscBundleReceiver oscReceiver;
 		ofxOscSender oscSender;
 		void setupOsc();
 		void processOscMessages();
+		void applyOscMessage(ofxOscMessage& m);
 		void sendOscParameter(string address, float value);
 		void sendOscString(string address, string value);
 		void sendAllOscParameters();
@@ -51,17 +63,35 @@ class ofApp : public ofBaseApp{
 		void sendOscBlock3B2();
 		void sendOscBlock3MatrixAndFinal();
 
-		// OSC Process Helper Functions (split to avoid compiler limits)
-		bool processOscBlock1(const string& address, float value, const ofxOscMessage& m);
-		bool processOscBlock2(const string& address, float value, const ofxOscMessage& m);
-		bool processOscBlock3(const string& address, float value, const ofxOscMessage& m);
-		bool processOscDiscreteParams(const string& address, const ofxOscMessage& m);
-		bool processOscBooleanParams(const string& address, const ofxOscMessage& m);
-		bool processOscLfoParamsFb(const string& address, float value);
-		bool processOscLfoParamsBlock3B1(const string& address, float value);
-		bool processOscLfoParamsBlock3B2AndMatrix(const string& address, float value);
+		// OSC commands that are not registered parameters
+		bool processOscSettingsCommands(const string& address, const ofxOscMessage& m);
 		bool processOscResetCommands(const string& address);
 		bool processOscPresetCommands(const string& address, const ofxOscMessage& m);
+		// Replies the controller expects after a registered parameter changes
+		void sendOscParameterEcho(const string& address);
+
+		// OSC address patterns (*, ?, [], {}) - each unique pattern is compiled
+		// once and its resolved parameter handles are cached
+		struct OscPatternEntry {
+			OscAddressPattern pattern;
+			std::vector<OscParameter*> handles;
+		};
+		std::unordered_map<std::string, OscPatternEntry> oscPatternCache;
+		const size_t oscPatternCacheLimit = 512;
+		const std::vector<OscParameter*>& resolveOscPattern(const string& address);
+
+		// Timetagged bundle scheduling - messages keyed by due time (seconds since epoch)
+		std::multimap<double, ofxOscMessage> oscSchedule;
+		double oscScheduleHorizon = 10.0;  // seconds; further ahead means clocks disagree
+		void scheduleOscMessage(OscBundleReceiver::TimedMessage& timed, double now);
+		struct OscBundleStats {
+			uint64_t scheduled = 0;
+			uint64_t early = 0;
+			uint64_t late = 0;
+			uint64_t outOfRange = 0;
+			float worstLateMs = 0;
+		};
+		OscBundleStats oscBundleStats;
 
 	//globals
 	// Input resolutions
@@ -89,6 +119,8 @@ class ofApp : public ofBaseApp{
 	//video inputs
 	void inputSetup();
 	void inputUpdate();
+	// Scaled texture of input 0 or 1 for its current source type, null if there is none
+	const ofTexture* inputTexture(int input);
 	void inputTest();
 	void reinitializeInputs();
 	ofVideoGrabber input1;
@@ -161,10 +193,27 @@ class ofApp : public ofBaseApp{
 	ofFbo framebuffer2;
 	ofFbo framebuffer3;
 
-	//shaders
-	ofShader shader1;
-	ofShader shader2;
-	ofShader shader3;
+	// Preset thumbnails - framebuffer3 is reduced through its mip chain into a
+	// small FBO and read back through a PBO. A fence tells when the copy is
+	// done, so mapping never waits on the GPU; the GUI encodes the PNG.
+	static const int thumbnailWidth = 160;
+	static const int thumbnailHeight = 90;
+	void thumbnailSetup();
+	void thumbnailUpdate();
+	void thumbnailCleanup();
+	// Captures the output after delayFrames; replaces a pending capture, "" cancels it
+	void captureThumbnail(const std::string& path, int delayFrames);
+	ofFbo thumbnailFbo;
+	GLuint thumbnailPbo[2];
+	GLsync thumbnailFence[2] = {nullptr, nullptr};
+	std::string thumbnailReadPath[2];
+	std::string thumbnailPendingPath;
+	int thumbnailPendingFrames = 0;
+
+	//shaders, linked binaries kept in bin/data/shaderCache
+	CachedShader shader1;
+	CachedShader shader2;
+	CachedShader shader3;
 
 
 	//COEFFICIENTS
@@ -471,6 +520,19 @@ class ofApp : public ofBaseApp{
 	float finalKeyThresholdTheta=0;
 	float finalKeySoftTheta=0;
 
+	// Blur and sharpen of every block source, run ahead of the block shaders
+	FilterPrepass filterPrepass;
+	// Block 1 and 2 colorize bands, baked for shader3
+	ColorizeLut colorizeLut;
+	// Render scale of blocks 1 and 2 against the frame budget
+	ResolutionGovernor resolutionGovernor;
+	// Blocks 1 and 2 from the internal to the output resolution
+	Upscaler upscaler;
+
+	// Triangles of the line, hypercube, seven star and lissaball generators,
+	// drawn once per block
+	GeneratorBatch generatorBatch;
+
 	//hypercube
 	void hypercube_draw();
 
@@ -550,10 +612,26 @@ class ofApp : public ofBaseApp{
 	float spiralTheta3Inc = .05;
 
 	// ============== LISSAJOUS CURVE GENERATOR ==============
+	// std140 mirror of the LissajousParams block in shadersGL4/lissajous.vert
+	struct LissajousUniforms {
+		glm::vec4 freq;
+		glm::vec4 amp;
+		glm::vec4 phase;
+		glm::ivec4 shape;
+		glm::vec4 center;
+		glm::vec4 hue;
+		glm::vec4 chop;
+		glm::vec4 instances;
+	};
+	static const GLuint LISSAJOUS_UNIFORM_BINDING = 1;
+
+	void lissajousSetup(const std::string& shaderDir);
 	void lissajousCurve1Draw();
 	void lissajousCurve2Draw();
-	float lissajousWave(float theta, int shape);
-	float chopEnvelope(float pos, int shape);
+	void lissajousCurveRender(int block, const LissajousUniforms& params, float lineWidth);
+	ofShader lissajousShader;
+	ofBufferObject lissajousUniformBuffer[2];  // one per block, both are drawn every frame
+	GLuint generatorVao = 0;                    // attribute-less draws still need a vertex array bound
 
 	// Animation thetas
 	float lissajous1Theta = 0;
@@ -604,4 +682,10 @@ class ofApp : public ofBaseApp{
 	float lissajous2HueSpreadLfoTheta = 0;
 	float lissajous2ChopLfoTheta = 0;
 	float lissajous2ChopRatioLfoTheta = 0;
+
+	// ============== PARTICLE GENERATOR ==============
+	// Advances and draws a block's particles over its last feedback frame,
+	// of which the lower left fieldScale was rendered
+	void particlesDraw(int block, const ofTexture& field, glm::vec2 fieldScale);
+	ParticleGenerator particleGenerator;
 };